@@ -110,6 +110,60 @@ def write_knight_moves(f):
     f.write("};\n\n")
 
 
+def aligned_direction(a, b):
+    """Unit step from square a towards square b, or None if not on a shared line."""
+    dx = (b % 8) - (a % 8)
+    dy = (b // 8) - (a // 8)
+    if a == b:
+        return None
+    if dx == 0 or dy == 0 or abs(dx) == abs(dy):
+        return ((dx > 0) - (dx < 0), (dy > 0) - (dy < 0))
+    return None
+
+
+def write_between(f):
+    f.write("static const u64 BITBOARD_BETWEEN[64][64] = {\n")
+    for a in range(64):
+        f.write("\t{\n")
+        for b in range(64):
+            board = [0 for _ in range(64)]
+            step = aligned_direction(a, b)
+            if step is not None:
+                col = a % 8 + step[0]
+                row = a // 8 + step[1]
+                while row*8 + col != b:
+                    board[row*8 + col] = 1
+                    col += step[0]
+                    row += step[1]
+            f.write("\t\t")
+            write_binary_hex(board, f)
+            f.write(",\n")
+        f.write("\t},\n")
+    f.write("};\n\n")
+
+
+def write_line(f):
+    f.write("static const u64 BITBOARD_LINE[64][64] = {\n")
+    for a in range(64):
+        f.write("\t{\n")
+        for b in range(64):
+            board = [0 for _ in range(64)]
+            step = aligned_direction(a, b)
+            if step is not None:
+                for sign in (1, -1):
+                    col = a % 8
+                    row = a // 8
+                    while in_bounds(col) and in_bounds(row):
+                        board[row*8 + col] = 1
+                        col += sign * step[0]
+                        row += sign * step[1]
+            f.write("\t\t")
+            write_binary_hex(board, f)
+            f.write(",\n")
+        f.write("\t},\n")
+    f.write("};\n\n")
+
+
 def write_zobrist_keys(f):
     f.write("static const u64 ZOBRIST_KEYS[781] = {\n")
     for source in range(781):
@@ -141,4 +195,6 @@ if __name__ == "__main__":
         write_king_moves(f)
         write_bishop_moves(f)
         write_rook_moves(f)
+        write_between(f)
+        write_line(f)
         write_zobrist_keys(f)
@@ -674,6 +674,8460 @@ static const u64 BITBOARD_ROOK_RAYS[4][64] = {
 	},
 };
 
+static const u64 BITBOARD_BETWEEN[64][64] = {
+	{
+		0x00,
+		0x00,
+		0x02,
+		0x06,
+		0x0E,
+		0x1E,
+		0x3E,
+		0x7E,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100,
+		0x00,
+		0x200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10100,
+		0x00,
+		0x00,
+		0x40200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010100,
+		0x00,
+		0x00,
+		0x00,
+		0x8040200,
+		0x00,
+		0x00,
+		0x00,
+		0x101010100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040200,
+		0x00,
+		0x00,
+		0x10101010100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x201008040200,
+		0x00,
+		0x1010101010100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40201008040200,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x04,
+		0x0C,
+		0x1C,
+		0x3C,
+		0x7C,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200,
+		0x00,
+		0x400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20200,
+		0x00,
+		0x00,
+		0x80400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020200,
+		0x00,
+		0x00,
+		0x00,
+		0x10080400,
+		0x00,
+		0x00,
+		0x00,
+		0x202020200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080400,
+		0x00,
+		0x00,
+		0x20202020200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x402010080400,
+		0x00,
+		0x2020202020200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x02,
+		0x00,
+		0x00,
+		0x00,
+		0x08,
+		0x18,
+		0x38,
+		0x78,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200,
+		0x00,
+		0x400,
+		0x00,
+		0x800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40400,
+		0x00,
+		0x00,
+		0x100800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040400,
+		0x00,
+		0x00,
+		0x00,
+		0x20100800,
+		0x00,
+		0x00,
+		0x00,
+		0x404040400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100800,
+		0x00,
+		0x00,
+		0x40404040400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x06,
+		0x04,
+		0x00,
+		0x00,
+		0x00,
+		0x10,
+		0x30,
+		0x70,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400,
+		0x00,
+		0x800,
+		0x00,
+		0x1000,
+		0x00,
+		0x00,
+		0x20400,
+		0x00,
+		0x00,
+		0x80800,
+		0x00,
+		0x00,
+		0x201000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080800,
+		0x00,
+		0x00,
+		0x00,
+		0x40201000,
+		0x00,
+		0x00,
+		0x00,
+		0x808080800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x0E,
+		0x0C,
+		0x08,
+		0x00,
+		0x00,
+		0x00,
+		0x20,
+		0x60,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x800,
+		0x00,
+		0x1000,
+		0x00,
+		0x2000,
+		0x00,
+		0x00,
+		0x40800,
+		0x00,
+		0x00,
+		0x101000,
+		0x00,
+		0x00,
+		0x402000,
+		0x2040800,
+		0x00,
+		0x00,
+		0x00,
+		0x10101000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010101000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x1E,
+		0x1C,
+		0x18,
+		0x10,
+		0x00,
+		0x00,
+		0x00,
+		0x40,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000,
+		0x00,
+		0x2000,
+		0x00,
+		0x4000,
+		0x00,
+		0x00,
+		0x81000,
+		0x00,
+		0x00,
+		0x202000,
+		0x00,
+		0x00,
+		0x00,
+		0x4081000,
+		0x00,
+		0x00,
+		0x00,
+		0x20202000,
+		0x00,
+		0x00,
+		0x204081000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020202000,
+		0x00,
+		0x00,
+	},
+	{
+		0x3E,
+		0x3C,
+		0x38,
+		0x30,
+		0x20,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000,
+		0x00,
+		0x4000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102000,
+		0x00,
+		0x00,
+		0x404000,
+		0x00,
+		0x00,
+		0x00,
+		0x8102000,
+		0x00,
+		0x00,
+		0x00,
+		0x40404000,
+		0x00,
+		0x00,
+		0x408102000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404000,
+		0x00,
+		0x20408102000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040404000,
+		0x00,
+	},
+	{
+		0x7E,
+		0x7C,
+		0x78,
+		0x70,
+		0x60,
+		0x40,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000,
+		0x00,
+		0x8000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204000,
+		0x00,
+		0x00,
+		0x808000,
+		0x00,
+		0x00,
+		0x00,
+		0x10204000,
+		0x00,
+		0x00,
+		0x00,
+		0x80808000,
+		0x00,
+		0x00,
+		0x810204000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808000,
+		0x00,
+		0x40810204000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808000,
+		0x2040810204000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080808000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200,
+		0x600,
+		0xE00,
+		0x1E00,
+		0x3E00,
+		0x7E00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000,
+		0x00,
+		0x20000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010000,
+		0x00,
+		0x00,
+		0x4020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010000,
+		0x00,
+		0x00,
+		0x00,
+		0x804020000,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100804020000,
+		0x00,
+		0x00,
+		0x1010101010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20100804020000,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400,
+		0xC00,
+		0x1C00,
+		0x3C00,
+		0x7C00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000,
+		0x00,
+		0x40000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020000,
+		0x00,
+		0x00,
+		0x8040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020000,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040000,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x201008040000,
+		0x00,
+		0x00,
+		0x2020202020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40201008040000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200,
+		0x00,
+		0x00,
+		0x00,
+		0x800,
+		0x1800,
+		0x3800,
+		0x7800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000,
+		0x00,
+		0x40000,
+		0x00,
+		0x80000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040000,
+		0x00,
+		0x00,
+		0x10080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040000,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080000,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x402010080000,
+		0x00,
+		0x00,
+		0x4040404040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x600,
+		0x400,
+		0x00,
+		0x00,
+		0x00,
+		0x1000,
+		0x3000,
+		0x7000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000,
+		0x00,
+		0x80000,
+		0x00,
+		0x100000,
+		0x00,
+		0x00,
+		0x2040000,
+		0x00,
+		0x00,
+		0x8080000,
+		0x00,
+		0x00,
+		0x20100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080000,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100000,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE00,
+		0xC00,
+		0x800,
+		0x00,
+		0x00,
+		0x00,
+		0x2000,
+		0x6000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80000,
+		0x00,
+		0x100000,
+		0x00,
+		0x200000,
+		0x00,
+		0x00,
+		0x4080000,
+		0x00,
+		0x00,
+		0x10100000,
+		0x00,
+		0x00,
+		0x40200000,
+		0x204080000,
+		0x00,
+		0x00,
+		0x00,
+		0x1010100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010100000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E00,
+		0x1C00,
+		0x1800,
+		0x1000,
+		0x00,
+		0x00,
+		0x00,
+		0x4000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100000,
+		0x00,
+		0x200000,
+		0x00,
+		0x400000,
+		0x00,
+		0x00,
+		0x8100000,
+		0x00,
+		0x00,
+		0x20200000,
+		0x00,
+		0x00,
+		0x00,
+		0x408100000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020200000,
+		0x00,
+		0x00,
+		0x20408100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020200000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E00,
+		0x3C00,
+		0x3800,
+		0x3000,
+		0x2000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000,
+		0x00,
+		0x400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10200000,
+		0x00,
+		0x00,
+		0x40400000,
+		0x00,
+		0x00,
+		0x00,
+		0x810200000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040400000,
+		0x00,
+		0x00,
+		0x40810200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040400000,
+		0x00,
+		0x2040810200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040400000,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E00,
+		0x7C00,
+		0x7800,
+		0x7000,
+		0x6000,
+		0x4000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000,
+		0x00,
+		0x800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20400000,
+		0x00,
+		0x00,
+		0x80800000,
+		0x00,
+		0x00,
+		0x00,
+		0x1020400000,
+		0x00,
+		0x00,
+		0x00,
+		0x8080800000,
+		0x00,
+		0x00,
+		0x81020400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080800000,
+		0x00,
+		0x4081020400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080800000,
+	},
+	{
+		0x100,
+		0x00,
+		0x200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000,
+		0x60000,
+		0xE0000,
+		0x1E0000,
+		0x3E0000,
+		0x7E0000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000,
+		0x00,
+		0x2000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101000000,
+		0x00,
+		0x00,
+		0x402000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101000000,
+		0x00,
+		0x00,
+		0x00,
+		0x80402000000,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10080402000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x200,
+		0x00,
+		0x400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000,
+		0xC0000,
+		0x1C0000,
+		0x3C0000,
+		0x7C0000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000,
+		0x00,
+		0x4000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202000000,
+		0x00,
+		0x00,
+		0x804000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202000000,
+		0x00,
+		0x00,
+		0x00,
+		0x100804000000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20100804000000,
+		0x00,
+	},
+	{
+		0x200,
+		0x00,
+		0x400,
+		0x00,
+		0x800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000,
+		0x00,
+		0x00,
+		0x00,
+		0x80000,
+		0x180000,
+		0x380000,
+		0x780000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000,
+		0x00,
+		0x4000000,
+		0x00,
+		0x8000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404000000,
+		0x00,
+		0x00,
+		0x1008000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404000000,
+		0x00,
+		0x00,
+		0x00,
+		0x201008000000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40201008000000,
+	},
+	{
+		0x00,
+		0x400,
+		0x00,
+		0x800,
+		0x00,
+		0x1000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x60000,
+		0x40000,
+		0x00,
+		0x00,
+		0x00,
+		0x100000,
+		0x300000,
+		0x700000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000,
+		0x00,
+		0x8000000,
+		0x00,
+		0x10000000,
+		0x00,
+		0x00,
+		0x204000000,
+		0x00,
+		0x00,
+		0x808000000,
+		0x00,
+		0x00,
+		0x2010000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808000000,
+		0x00,
+		0x00,
+		0x00,
+		0x402010000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x800,
+		0x00,
+		0x1000,
+		0x00,
+		0x2000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE0000,
+		0xC0000,
+		0x80000,
+		0x00,
+		0x00,
+		0x00,
+		0x200000,
+		0x600000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8000000,
+		0x00,
+		0x10000000,
+		0x00,
+		0x20000000,
+		0x00,
+		0x00,
+		0x408000000,
+		0x00,
+		0x00,
+		0x1010000000,
+		0x00,
+		0x00,
+		0x4020000000,
+		0x20408000000,
+		0x00,
+		0x00,
+		0x00,
+		0x101010000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x1000,
+		0x00,
+		0x2000,
+		0x00,
+		0x4000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E0000,
+		0x1C0000,
+		0x180000,
+		0x100000,
+		0x00,
+		0x00,
+		0x00,
+		0x400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000,
+		0x00,
+		0x20000000,
+		0x00,
+		0x40000000,
+		0x00,
+		0x00,
+		0x810000000,
+		0x00,
+		0x00,
+		0x2020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40810000000,
+		0x00,
+		0x00,
+		0x00,
+		0x202020000000,
+		0x00,
+		0x00,
+		0x2040810000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000,
+		0x00,
+		0x4000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E0000,
+		0x3C0000,
+		0x380000,
+		0x300000,
+		0x200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000,
+		0x00,
+		0x40000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020000000,
+		0x00,
+		0x00,
+		0x4040000000,
+		0x00,
+		0x00,
+		0x00,
+		0x81020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x404040000000,
+		0x00,
+		0x00,
+		0x4081020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040000000,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000,
+		0x00,
+		0x8000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E0000,
+		0x7C0000,
+		0x780000,
+		0x700000,
+		0x600000,
+		0x400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000,
+		0x00,
+		0x80000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040000000,
+		0x00,
+		0x00,
+		0x8080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x102040000000,
+		0x00,
+		0x00,
+		0x00,
+		0x808080000000,
+		0x00,
+		0x00,
+		0x8102040000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080000000,
+	},
+	{
+		0x10100,
+		0x00,
+		0x00,
+		0x20400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000,
+		0x00,
+		0x20000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000,
+		0x6000000,
+		0xE000000,
+		0x1E000000,
+		0x3E000000,
+		0x7E000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100000000,
+		0x00,
+		0x200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10100000000,
+		0x00,
+		0x00,
+		0x40200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8040200000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x20200,
+		0x00,
+		0x00,
+		0x40800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000,
+		0x00,
+		0x40000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000,
+		0xC000000,
+		0x1C000000,
+		0x3C000000,
+		0x7C000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000,
+		0x00,
+		0x400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20200000000,
+		0x00,
+		0x00,
+		0x80400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10080400000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x40400,
+		0x00,
+		0x00,
+		0x81000,
+		0x00,
+		0x00,
+		0x20000,
+		0x00,
+		0x40000,
+		0x00,
+		0x80000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8000000,
+		0x18000000,
+		0x38000000,
+		0x78000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000,
+		0x00,
+		0x400000000,
+		0x00,
+		0x800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40400000000,
+		0x00,
+		0x00,
+		0x100800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20100800000000,
+		0x00,
+	},
+	{
+		0x40200,
+		0x00,
+		0x00,
+		0x80800,
+		0x00,
+		0x00,
+		0x102000,
+		0x00,
+		0x00,
+		0x40000,
+		0x00,
+		0x80000,
+		0x00,
+		0x100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x6000000,
+		0x4000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000,
+		0x30000000,
+		0x70000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000000,
+		0x00,
+		0x800000000,
+		0x00,
+		0x1000000000,
+		0x00,
+		0x00,
+		0x20400000000,
+		0x00,
+		0x00,
+		0x80800000000,
+		0x00,
+		0x00,
+		0x201000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40201000000000,
+	},
+	{
+		0x00,
+		0x80400,
+		0x00,
+		0x00,
+		0x101000,
+		0x00,
+		0x00,
+		0x204000,
+		0x00,
+		0x00,
+		0x80000,
+		0x00,
+		0x100000,
+		0x00,
+		0x200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE000000,
+		0xC000000,
+		0x8000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000,
+		0x60000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x800000000,
+		0x00,
+		0x1000000000,
+		0x00,
+		0x2000000000,
+		0x00,
+		0x00,
+		0x40800000000,
+		0x00,
+		0x00,
+		0x101000000000,
+		0x00,
+		0x00,
+		0x402000000000,
+		0x2040800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10101000000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x100800,
+		0x00,
+		0x00,
+		0x202000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100000,
+		0x00,
+		0x200000,
+		0x00,
+		0x400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E000000,
+		0x1C000000,
+		0x18000000,
+		0x10000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000000,
+		0x00,
+		0x2000000000,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x00,
+		0x81000000000,
+		0x00,
+		0x00,
+		0x202000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x4081000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20202000000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x201000,
+		0x00,
+		0x00,
+		0x404000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000,
+		0x00,
+		0x400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E000000,
+		0x3C000000,
+		0x38000000,
+		0x30000000,
+		0x20000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102000000000,
+		0x00,
+		0x00,
+		0x404000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8102000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40404000000000,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x402000,
+		0x00,
+		0x00,
+		0x808000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000,
+		0x00,
+		0x800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E000000,
+		0x7C000000,
+		0x78000000,
+		0x70000000,
+		0x60000000,
+		0x40000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x8000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204000000000,
+		0x00,
+		0x00,
+		0x808000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10204000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x80808000000000,
+	},
+	{
+		0x1010100,
+		0x00,
+		0x00,
+		0x00,
+		0x2040800,
+		0x00,
+		0x00,
+		0x00,
+		0x1010000,
+		0x00,
+		0x00,
+		0x2040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000,
+		0x00,
+		0x2000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000,
+		0x600000000,
+		0xE00000000,
+		0x1E00000000,
+		0x3E00000000,
+		0x7E00000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000000,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010000000000,
+		0x00,
+		0x00,
+		0x4020000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x2020200,
+		0x00,
+		0x00,
+		0x00,
+		0x4081000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020000,
+		0x00,
+		0x00,
+		0x4080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000,
+		0x00,
+		0x4000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000000,
+		0xC00000000,
+		0x1C00000000,
+		0x3C00000000,
+		0x7C00000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x40000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020000000000,
+		0x00,
+		0x00,
+		0x8040000000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x4040400,
+		0x00,
+		0x00,
+		0x00,
+		0x8102000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040000,
+		0x00,
+		0x00,
+		0x8100000,
+		0x00,
+		0x00,
+		0x2000000,
+		0x00,
+		0x4000000,
+		0x00,
+		0x8000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x800000000,
+		0x1800000000,
+		0x3800000000,
+		0x7800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x40000000000,
+		0x00,
+		0x80000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040000000000,
+		0x00,
+		0x00,
+		0x10080000000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x8080800,
+		0x00,
+		0x00,
+		0x00,
+		0x10204000,
+		0x4020000,
+		0x00,
+		0x00,
+		0x8080000,
+		0x00,
+		0x00,
+		0x10200000,
+		0x00,
+		0x00,
+		0x4000000,
+		0x00,
+		0x8000000,
+		0x00,
+		0x10000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x600000000,
+		0x400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000000,
+		0x3000000000,
+		0x7000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000000,
+		0x00,
+		0x80000000000,
+		0x00,
+		0x100000000000,
+		0x00,
+		0x00,
+		0x2040000000000,
+		0x00,
+		0x00,
+		0x8080000000000,
+		0x00,
+		0x00,
+		0x20100000000000,
+		0x00,
+	},
+	{
+		0x8040200,
+		0x00,
+		0x00,
+		0x00,
+		0x10101000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040000,
+		0x00,
+		0x00,
+		0x10100000,
+		0x00,
+		0x00,
+		0x20400000,
+		0x00,
+		0x00,
+		0x8000000,
+		0x00,
+		0x10000000,
+		0x00,
+		0x20000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE00000000,
+		0xC00000000,
+		0x800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000,
+		0x6000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80000000000,
+		0x00,
+		0x100000000000,
+		0x00,
+		0x200000000000,
+		0x00,
+		0x00,
+		0x4080000000000,
+		0x00,
+		0x00,
+		0x10100000000000,
+		0x00,
+		0x00,
+		0x40200000000000,
+	},
+	{
+		0x00,
+		0x10080400,
+		0x00,
+		0x00,
+		0x00,
+		0x20202000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10080000,
+		0x00,
+		0x00,
+		0x20200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000,
+		0x00,
+		0x20000000,
+		0x00,
+		0x40000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E00000000,
+		0x1C00000000,
+		0x1800000000,
+		0x1000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100000000000,
+		0x00,
+		0x200000000000,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x00,
+		0x8100000000000,
+		0x00,
+		0x00,
+		0x20200000000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x20100800,
+		0x00,
+		0x00,
+		0x00,
+		0x40404000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20100000,
+		0x00,
+		0x00,
+		0x40400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000,
+		0x00,
+		0x40000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E00000000,
+		0x3C00000000,
+		0x3800000000,
+		0x3000000000,
+		0x2000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000000,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10200000000000,
+		0x00,
+		0x00,
+		0x40400000000000,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x40201000,
+		0x00,
+		0x00,
+		0x00,
+		0x80808000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40200000,
+		0x00,
+		0x00,
+		0x80800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000,
+		0x00,
+		0x80000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E00000000,
+		0x7C00000000,
+		0x7800000000,
+		0x7000000000,
+		0x6000000000,
+		0x4000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x800000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20400000000000,
+		0x00,
+		0x00,
+		0x80800000000000,
+	},
+	{
+		0x101010100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081000,
+		0x00,
+		0x00,
+		0x101010000,
+		0x00,
+		0x00,
+		0x00,
+		0x204080000,
+		0x00,
+		0x00,
+		0x00,
+		0x101000000,
+		0x00,
+		0x00,
+		0x204000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100000000,
+		0x00,
+		0x200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000,
+		0x60000000000,
+		0xE0000000000,
+		0x1E0000000000,
+		0x3E0000000000,
+		0x7E0000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000000000,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x202020200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102000,
+		0x00,
+		0x00,
+		0x202020000,
+		0x00,
+		0x00,
+		0x00,
+		0x408100000,
+		0x00,
+		0x00,
+		0x00,
+		0x202000000,
+		0x00,
+		0x00,
+		0x408000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000,
+		0x00,
+		0x400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000000,
+		0xC0000000000,
+		0x1C0000000000,
+		0x3C0000000000,
+		0x7C0000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x4000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x404040400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204000,
+		0x00,
+		0x00,
+		0x404040000,
+		0x00,
+		0x00,
+		0x00,
+		0x810200000,
+		0x00,
+		0x00,
+		0x00,
+		0x404000000,
+		0x00,
+		0x00,
+		0x810000000,
+		0x00,
+		0x00,
+		0x200000000,
+		0x00,
+		0x400000000,
+		0x00,
+		0x800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x80000000000,
+		0x180000000000,
+		0x380000000000,
+		0x780000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x4000000000000,
+		0x00,
+		0x8000000000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x808080800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080000,
+		0x00,
+		0x00,
+		0x00,
+		0x1020400000,
+		0x402000000,
+		0x00,
+		0x00,
+		0x808000000,
+		0x00,
+		0x00,
+		0x1020000000,
+		0x00,
+		0x00,
+		0x400000000,
+		0x00,
+		0x800000000,
+		0x00,
+		0x1000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x60000000000,
+		0x40000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x100000000000,
+		0x300000000000,
+		0x700000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000000000,
+		0x00,
+		0x8000000000000,
+		0x00,
+		0x10000000000000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101000,
+		0x00,
+		0x00,
+		0x00,
+		0x804020000,
+		0x00,
+		0x00,
+		0x00,
+		0x1010100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804000000,
+		0x00,
+		0x00,
+		0x1010000000,
+		0x00,
+		0x00,
+		0x2040000000,
+		0x00,
+		0x00,
+		0x800000000,
+		0x00,
+		0x1000000000,
+		0x00,
+		0x2000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE0000000000,
+		0xC0000000000,
+		0x80000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000000,
+		0x600000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8000000000000,
+		0x00,
+		0x10000000000000,
+		0x00,
+		0x20000000000000,
+		0x00,
+	},
+	{
+		0x1008040200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202000,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020200000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008000000,
+		0x00,
+		0x00,
+		0x2020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000000,
+		0x00,
+		0x2000000000,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E0000000000,
+		0x1C0000000000,
+		0x180000000000,
+		0x100000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000000000,
+		0x00,
+		0x20000000000000,
+		0x00,
+		0x40000000000000,
+	},
+	{
+		0x00,
+		0x2010080400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404000,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040400000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010000000,
+		0x00,
+		0x00,
+		0x4040000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E0000000000,
+		0x3C0000000000,
+		0x380000000000,
+		0x300000000000,
+		0x200000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000000,
+		0x00,
+		0x40000000000000,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x4020100800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808000,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100000,
+		0x00,
+		0x00,
+		0x00,
+		0x8080800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020000000,
+		0x00,
+		0x00,
+		0x8080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000000,
+		0x00,
+		0x8000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E0000000000,
+		0x7C0000000000,
+		0x780000000000,
+		0x700000000000,
+		0x600000000000,
+		0x400000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000000000,
+		0x00,
+		0x80000000000000,
+	},
+	{
+		0x10101010100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20408102000,
+		0x00,
+		0x10101010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20408100000,
+		0x00,
+		0x00,
+		0x10101000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20408000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10100000000,
+		0x00,
+		0x00,
+		0x20400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000000,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000000,
+		0x6000000000000,
+		0xE000000000000,
+		0x1E000000000000,
+		0x3E000000000000,
+		0x7E000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x20202020200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40810204000,
+		0x00,
+		0x20202020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40810200000,
+		0x00,
+		0x00,
+		0x20202000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40810000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20200000000,
+		0x00,
+		0x00,
+		0x40800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x40000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000000000,
+		0xC000000000000,
+		0x1C000000000000,
+		0x3C000000000000,
+		0x7C000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x40404040400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x81020400000,
+		0x00,
+		0x00,
+		0x40404000000,
+		0x00,
+		0x00,
+		0x00,
+		0x81020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40400000000,
+		0x00,
+		0x00,
+		0x81000000000,
+		0x00,
+		0x00,
+		0x20000000000,
+		0x00,
+		0x40000000000,
+		0x00,
+		0x80000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8000000000000,
+		0x18000000000000,
+		0x38000000000000,
+		0x78000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x80808080800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808000000,
+		0x00,
+		0x00,
+		0x00,
+		0x102040000000,
+		0x40200000000,
+		0x00,
+		0x00,
+		0x80800000000,
+		0x00,
+		0x00,
+		0x102000000000,
+		0x00,
+		0x00,
+		0x40000000000,
+		0x00,
+		0x80000000000,
+		0x00,
+		0x100000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x6000000000000,
+		0x4000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000000000,
+		0x30000000000000,
+		0x70000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010100000,
+		0x00,
+		0x00,
+		0x00,
+		0x80402000000,
+		0x00,
+		0x00,
+		0x00,
+		0x101010000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80400000000,
+		0x00,
+		0x00,
+		0x101000000000,
+		0x00,
+		0x00,
+		0x204000000000,
+		0x00,
+		0x00,
+		0x80000000000,
+		0x00,
+		0x100000000000,
+		0x00,
+		0x200000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE000000000000,
+		0xC000000000000,
+		0x8000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000000,
+		0x60000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202000,
+		0x00,
+		0x00,
+		0x100804020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020200000,
+		0x00,
+		0x00,
+		0x00,
+		0x100804000000,
+		0x00,
+		0x00,
+		0x00,
+		0x202020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100800000000,
+		0x00,
+		0x00,
+		0x202000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x100000000000,
+		0x00,
+		0x200000000000,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E000000000000,
+		0x1C000000000000,
+		0x18000000000000,
+		0x10000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x201008040200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404000,
+		0x00,
+		0x00,
+		0x201008040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040400000,
+		0x00,
+		0x00,
+		0x00,
+		0x201008000000,
+		0x00,
+		0x00,
+		0x00,
+		0x404040000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x201000000000,
+		0x00,
+		0x00,
+		0x404000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000000,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E000000000000,
+		0x3C000000000000,
+		0x38000000000000,
+		0x30000000000000,
+		0x20000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x402010080400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808000,
+		0x00,
+		0x00,
+		0x402010080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080800000,
+		0x00,
+		0x00,
+		0x00,
+		0x402010000000,
+		0x00,
+		0x00,
+		0x00,
+		0x808080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x402000000000,
+		0x00,
+		0x00,
+		0x808000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000000000,
+		0x00,
+		0x800000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E000000000000,
+		0x7C000000000000,
+		0x78000000000000,
+		0x70000000000000,
+		0x60000000000000,
+		0x40000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x1010101010100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040810204000,
+		0x1010101010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040810200000,
+		0x00,
+		0x1010101000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040810000000,
+		0x00,
+		0x00,
+		0x1010100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x2040800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x1010000000000,
+		0x00,
+		0x00,
+		0x2040000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000000000,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000000000,
+		0x600000000000000,
+		0xE00000000000000,
+		0x1E00000000000000,
+		0x3E00000000000000,
+		0x7E00000000000000,
+	},
+	{
+		0x00,
+		0x2020202020200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4081020400000,
+		0x00,
+		0x2020202000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4081020000000,
+		0x00,
+		0x00,
+		0x2020200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x4081000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020000000000,
+		0x00,
+		0x00,
+		0x4080000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x4000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x400000000000000,
+		0xC00000000000000,
+		0x1C00000000000000,
+		0x3C00000000000000,
+		0x7C00000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x4040404040400,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8102040000000,
+		0x00,
+		0x00,
+		0x4040400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8102000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040000000000,
+		0x00,
+		0x00,
+		0x8100000000000,
+		0x00,
+		0x00,
+		0x2000000000000,
+		0x00,
+		0x4000000000000,
+		0x00,
+		0x8000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x200000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x800000000000000,
+		0x1800000000000000,
+		0x3800000000000000,
+		0x7800000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080800,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10204000000000,
+		0x4020000000000,
+		0x00,
+		0x00,
+		0x8080000000000,
+		0x00,
+		0x00,
+		0x10200000000000,
+		0x00,
+		0x00,
+		0x4000000000000,
+		0x00,
+		0x8000000000000,
+		0x00,
+		0x10000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x600000000000000,
+		0x400000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x1000000000000000,
+		0x3000000000000000,
+		0x7000000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010101000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010100000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10101010000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8040200000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10101000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040000000000,
+		0x00,
+		0x00,
+		0x10100000000000,
+		0x00,
+		0x00,
+		0x20400000000000,
+		0x00,
+		0x00,
+		0x8000000000000,
+		0x00,
+		0x10000000000000,
+		0x00,
+		0x20000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xE00000000000000,
+		0xC00000000000000,
+		0x800000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x2000000000000000,
+		0x6000000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020202000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020200000,
+		0x00,
+		0x00,
+		0x10080402000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20202020000000,
+		0x00,
+		0x00,
+		0x00,
+		0x10080400000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20202000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10080000000000,
+		0x00,
+		0x00,
+		0x20200000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10000000000000,
+		0x00,
+		0x20000000000000,
+		0x00,
+		0x40000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1E00000000000000,
+		0x1C00000000000000,
+		0x1800000000000000,
+		0x1000000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x4000000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040404000,
+		0x00,
+		0x20100804020000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040400000,
+		0x00,
+		0x00,
+		0x20100804000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40404040000000,
+		0x00,
+		0x00,
+		0x00,
+		0x20100800000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40404000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20100000000000,
+		0x00,
+		0x00,
+		0x40400000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x20000000000000,
+		0x00,
+		0x40000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x3E00000000000000,
+		0x3C00000000000000,
+		0x3800000000000000,
+		0x3000000000000000,
+		0x2000000000000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x40201008040200,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080808000,
+		0x00,
+		0x40201008040000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080800000,
+		0x00,
+		0x00,
+		0x40201008000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80808080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x40201000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x80808000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40200000000000,
+		0x00,
+		0x00,
+		0x80800000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x40000000000000,
+		0x00,
+		0x80000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x7E00000000000000,
+		0x7C00000000000000,
+		0x7800000000000000,
+		0x7000000000000000,
+		0x6000000000000000,
+		0x4000000000000000,
+		0x00,
+		0x00,
+	},
+};
+
+static const u64 BITBOARD_LINE[64][64] = {
+	{
+		0x00,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x101010101010101,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+	},
+	{
+		0xFF,
+		0x00,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x102,
+		0x202020202020202,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0xFF,
+		0xFF,
+		0x00,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0x10204,
+		0x404040404040404,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0x00,
+		0x1020408,
+		0x808080808080808,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x1020408,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810,
+		0x1010101010101010,
+		0x80402010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x80402010,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x80402010,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0xFF,
+		0xFF,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x2020202020202020,
+		0x804020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x804020,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+	},
+	{
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0xFF,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x4040404040404040,
+		0x8040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+	},
+	{
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0xFF,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x102,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x101010101010101,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+	},
+	{
+		0x8040201008040201,
+		0x202020202020202,
+		0x10204,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x10204,
+		0x202020202020202,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+	},
+	{
+		0x00,
+		0x80402010080402,
+		0x404040404040404,
+		0x1020408,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0x1020408,
+		0x404040404040404,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x804020100804,
+		0x808080808080808,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0x00,
+		0x102040810,
+		0x808080808080808,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x1010101010101010,
+		0x10204081020,
+		0x00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x1010101010101010,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010,
+		0x2020202020202020,
+		0x1020408102040,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x2020202020202020,
+		0x80402010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x80402010,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020,
+		0x4040404040404040,
+		0x102040810204080,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0xFF00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x4040404040404040,
+		0x804020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040,
+		0x8080808080808080,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0xFF00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x00,
+		0x10204,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x10204,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x101010101010101,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x1020408,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x202020202020202,
+		0x1020408,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x1020408,
+		0x202020202020202,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+	},
+	{
+		0x8040201008040201,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x404040404040404,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0x102040810,
+		0x404040404040404,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+	},
+	{
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x808080808080808,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x808080808080808,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x1010101010101010,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x1010101010101010,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x2020202020202020,
+		0x102040810204080,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x2020202020202020,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010,
+		0x4040404040404040,
+		0x204081020408000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0xFF0000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x4040404040404040,
+		0x80402010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020,
+		0x8080808080808080,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0xFF0000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x1020408,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x1020408,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x1020408,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x101010101010101,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x202020202020202,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x102040810,
+		0x202020202020202,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x404040404040404,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0x10204081020,
+		0x404040404040404,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+	},
+	{
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x808080808080808,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x808080808080808,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+	},
+	{
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x1010101010101010,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x1010101010101010,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x2020202020202020,
+		0x204081020408000,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x2020202020202020,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x4040404040404040,
+		0x408102040800000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0xFF000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x4040404040404040,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010,
+		0x8080808080808080,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0xFF000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x102040810,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x101010101010101,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x202020202020202,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x10204081020,
+		0x202020202020202,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x404040404040404,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0x1020408102040,
+		0x404040404040404,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x808080808080808,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x808080808080808,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+	},
+	{
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x1010101010101010,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x1010101010101010,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x8040201008040201,
+	},
+	{
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x2020202020202020,
+		0x408102040800000,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x2020202020202020,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x4040404040404040,
+		0x810204080000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0xFF00000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x4040404040404040,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008,
+		0x8080808080808080,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0xFF00000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x00,
+		0x00,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x10204081020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x101010101010101,
+		0x402010000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x402010000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100000000,
+		0x202020202020202,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000000000,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x1020408102040,
+		0x202020202020202,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x404040404040404,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0x102040810204080,
+		0x404040404040404,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x808080808080808,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x808080808080808,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x1010101010101010,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x1010101010101010,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x4020100804020100,
+		0x00,
+	},
+	{
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x2020202020202020,
+		0x810204080000000,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x2020202020202020,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x8040201008040201,
+	},
+	{
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x4040404040404040,
+		0x1020408000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0xFF0000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x4040404040404040,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x00,
+		0x4040404040404040,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100804,
+		0x8080808080808080,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0xFF0000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040800000000000,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040800000000000,
+		0x00,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x1020408102040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x101010101010101,
+		0x201000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x402010000000000,
+		0x202020202020202,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000000000,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x102040810204080,
+		0x202020202020202,
+		0x402010000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x804020100000000,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100000000,
+		0x404040404040404,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0x204081020408000,
+		0x404040404040404,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x808080808080808,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x808080808080808,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x1010101010101010,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x1010101010101010,
+		0x2010080402010000,
+		0x00,
+		0x00,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x1020408000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x2020202020202020,
+		0x1020408000000000,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x2020202020202020,
+		0x4020100804020100,
+		0x00,
+	},
+	{
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x4040404040404040,
+		0x2040800000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0xFF000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2040800000000000,
+		0x4040404040404040,
+		0x8040201008040201,
+	},
+	{
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x80402010080402,
+		0x8080808080808080,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0xFF000000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4080000000000000,
+		0x8080808080808080,
+	},
+	{
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x00,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x101010101010101,
+		0x102040810204080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+	},
+	{
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x202020202020202,
+		0x00,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x201000000000000,
+		0x202020202020202,
+		0x204081020408000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000000000,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x402010000000000,
+		0x00,
+		0x404040404040404,
+		0x00,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x402010000000000,
+		0x404040404040404,
+		0x408102040800000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x804020100000000,
+		0x00,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x804020100000000,
+		0x00,
+		0x808080808080808,
+		0x00,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x804020100000000,
+		0x808080808080808,
+		0x810204080000000,
+		0x00,
+		0x00,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x00,
+		0x1020408000000000,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x00,
+		0x1010101010101010,
+		0x00,
+		0x1020408000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x1008040201000000,
+		0x1010101010101010,
+		0x1020408000000000,
+		0x00,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x00,
+		0x2020202020202020,
+		0x00,
+		0x2040800000000000,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x2010080402010000,
+		0x2020202020202020,
+		0x2040800000000000,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0x00,
+		0xFF00000000000000,
+		0xFF00000000000000,
+	},
+	{
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x00,
+		0x4040404040404040,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x4020100804020100,
+		0x4040404040404040,
+		0x4080000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0x00,
+		0xFF00000000000000,
+	},
+	{
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x00,
+		0x8080808080808080,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x00,
+		0x8040201008040201,
+		0x8080808080808080,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0xFF00000000000000,
+		0x00,
+	},
+};
+
 static const u64 ZOBRIST_KEYS[781] = {
 	0x2B9EECF9AB8145AA,
 	0xA84E6BCC117749B,
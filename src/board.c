@@ -51,6 +51,19 @@ u64 board_position_hash(Board *board) {
   return hash;
 }
 
+/**
+ * Fingerprint of the Zobrist keys, so hashes stored on disk can be checked
+ * against the keys this binary was built with.
+ */
+u64 zobrist_keys_signature(void) {
+  u64 signature = 0xcbf29ce484222325; // FNV-1a offset basis
+  for (i32 i = 0; i < (i32)(sizeof(ZOBRIST_KEYS) / sizeof(u64)); i++) {
+    signature ^= ZOBRIST_KEYS[i];
+    signature *= 0x100000001b3;
+  }
+  return signature;
+}
+
 u64 zobrist_key(i32 piece, u32 square, i32 color) {
   i32 base_offset = (piece - 2) * 128;
   i32 k = (base_offset + (i32)square) + (64 * color);
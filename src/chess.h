@@ -25,8 +25,12 @@ typedef uint32_t u32;
 
 typedef uint8_t u8;
 
+typedef int16_t i16;
+
 typedef int32_t i32;
 
+typedef int64_t i64;
+
 typedef double f64;
 
 static const i32 PROMOTION_BIT_FLAG = 0x8;
@@ -162,7 +166,7 @@ u32 bitscan_reverse(u64 bitset);
 
 i32 pop_count(u64 bitset);
 
-// u64 permute_mask(u64 mask, i32 index, i32 pop_count);
+u64 permute_mask(u64 mask, i32 index, i32 pop_count);
 
 /* Move */
 
@@ -194,6 +198,12 @@ MoveList generate_all_legal_moves(Board *board);
 
 MoveList generate_capture_moves(Board *board);
 
+MoveList generate_quiet_moves(Board *board);
+
+MoveList generate_evasion_moves(Board *board);
+
+bool board_is_move_legal(Board *board, Move mv);
+
 void bitboards_update(u64 *bitboards, i32 turn, Move mv);
 
 /* Board Metadata */
@@ -224,24 +234,45 @@ void board_initialize_startpos(Board *board);
 
 i32 board_legal_moves_count(Board *board);
 
+bool board_has_legal_move(Board *board);
+
 bool board_is_check(Board *board);
 
+bool board_move_gives_check(Board *board, Move mv);
+
 i32 board_status(Board *board); // TODO: 3fold, 50 move, etc.
 
 u64 board_position_hash(Board *board);
 
 /* Board Modifiers*/
 
+/**
+ * If set, board_make_move calls this with the new position's hash as soon as
+ * it is known, so the search can prefetch its transposition table entry while
+ * the rest of the move is made.
+ */
+extern void (*board_hash_prefetch)(u64 hash);
+
 void board_make_move(Board *board, Move mv);
 
 void board_unmake(Board *board);
 
+/**
+ * Null move: the side to move passes. Only meaningful to the search, and must
+ * be undone with board_unmake_null_move rather than board_unmake.
+ */
+void board_make_null_move(Board *board);
+
+void board_unmake_null_move(Board *board);
+
 /* Piece movement */
 
 i32 attacker_count(u64 bitset, u64 *bitboards, i32 attacking_color);
 
 bool is_attacked(u64 bitset, u64 *bitboards, i32 attacking_color);
 
+i32 static_exchange_evaluation(Board *board, Move mv);
+
 u64 king_moves(u32 source_idx);
 
 u64 knight_moves(u32 source_idx);
@@ -250,6 +281,10 @@ u64 bishop_moves(u32 source_idx, u64 occupancy_mask);
 
 u64 rook_moves(u32 source_idx, u64 occupancy_mask);
 
+void init_slider_attacks(void);
+
+const char *slider_backend_name(void);
+
 u64 pawn_attacks(u64 source_bitset, i32 side);
 
 u64 pawn_forward_moves(u64 source_bitset, i32 side);
@@ -257,3 +292,5 @@ u64 pawn_forward_moves(u64 source_bitset, i32 side);
 /* Zobrist hashing */
 
 u64 zobrist_key(i32 piece, u32 square, i32 color);
+
+u64 zobrist_keys_signature(void);
@@ -36,8 +36,7 @@ i32 board_status(Board *board) {
     if (md->_is_repetition || (md->_halfmove_counter >= 100)) {
         return kDraw;
     }
-    int legal_count = board_legal_moves_count(board);
-    if (legal_count == 0) {
+    if (!board_has_legal_move(board)) {
         bool check = board_is_check(board);
         if (check) {
             return kCheckmate;
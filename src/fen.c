@@ -66,7 +66,7 @@ void parse_piece_placement(Board *board, const char *fen, i32 *i) {
     case '6':
     case '7':
     case '8': {
-      const i32 count = atoi(&c);
+      const i32 count = c - '0';
       col += count;
       break;
     }
@@ -0,0 +1,201 @@
+#include "bitboard_constants.h"
+#include "chess.h"
+#include "move_generation.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if BLOBFISH_HAS_PEXT
+#include <cpuid.h>
+#endif
+
+/**
+ * Slider attack tables are generated at startup instead of by the Python
+ * script: they are too large to be worth checking in, and searching for the
+ * magic numbers themselves only takes tens of milliseconds.
+ * Both backends share the same table layout (2^bits entries per square), they
+ * only differ in how the masked occupancy is turned into an index.
+ */
+
+#define BISHOP_TABLE_SIZE 5248
+#define ROOK_TABLE_SIZE 102400
+
+Magic BISHOP_MAGICS[64];
+Magic ROOK_MAGICS[64];
+
+i32 slider_backend = kSliderBackendMagic;
+
+static u64 bishop_attack_table[BISHOP_TABLE_SIZE];
+static u64 rook_attack_table[ROOK_TABLE_SIZE];
+
+typedef u32 (*bitscan_function)(u64);
+
+/**
+ * Ray-walking slider attacks. Slow, but obviously correct, so we use these to
+ * fill in (and then verify) the magic tables.
+ */
+static u64 slider_moves_slow(const u64 rays[4][64], u32 source_idx,
+                             u64 occupancy_mask) {
+  static bitscan_function bitscan_fns[4] = {bitscan_forward, bitscan_forward,
+                                            bitscan_reverse, bitscan_reverse};
+  u64 result = 0;
+  for (i32 direction = 0; direction < 4; direction++) {
+    const u64 ray = rays[direction][source_idx];
+    const u64 overlaps = ray & occupancy_mask;
+    result |= ray;
+    if (overlaps) {
+      result &= ~(rays[direction][bitscan_fns[direction](overlaps)]);
+    }
+  }
+  return result;
+}
+
+/**
+ * Relevant occupancy: every ray square except the last one, since a blocker
+ * on the board edge never changes the attack set.
+ */
+static u64 slider_relevant_mask(const u64 rays[4][64], u32 source_idx) {
+  static bitscan_function last_square_fns[4] = {
+      bitscan_reverse, bitscan_reverse, bitscan_forward, bitscan_forward};
+  u64 mask = 0;
+  for (i32 direction = 0; direction < 4; direction++) {
+    const u64 ray = rays[direction][source_idx];
+    if (ray) {
+      mask |= ray & ~((u64)1 << last_square_fns[direction](ray));
+    }
+  }
+  return mask;
+}
+
+/**
+ * xorshift64*, seeded per rank so the tables are identical on every run.
+ * The seeds are the ones Stockfish found to converge quickly.
+ */
+static u64 magic_random(u64 *state) {
+  *state ^= *state >> 12;
+  *state ^= *state << 25;
+  *state ^= *state >> 27;
+  return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * Magics with few set bits are found much more quickly.
+ */
+static u64 magic_random_sparse(u64 *state) {
+  return magic_random(state) & magic_random(state) & magic_random(state);
+}
+
+static void slider_attacks_generate(const u64 rays[4][64], Magic *magics,
+                                    u64 *attack_table) {
+  static const u64 rank_seeds[8] = {728,   10316, 55013, 32803,
+                                    12281, 15100, 16645, 255};
+  static u64 occupancies[4096];
+  static u64 references[4096];
+  static i32 epoch[4096];
+  i32 attempt = 0;
+  u64 *attacks = attack_table;
+  memset(epoch, 0, sizeof(epoch));
+  for (u32 sq = 0; sq < 64; sq++) {
+    Magic *m = &magics[sq];
+    m->mask = slider_relevant_mask(rays, sq);
+    const i32 bits = pop_count(m->mask);
+    const i32 size = 1 << bits;
+    m->shift = 64 - bits;
+    m->attacks = attacks;
+    u64 rng_state = rank_seeds[sq / 8];
+    for (i32 i = 0; i < size; i++) {
+      occupancies[i] = permute_mask(m->mask, i, bits);
+      references[i] = slider_moves_slow(rays, sq, occupancies[i]);
+    }
+    if (slider_backend == kSliderBackendPext) {
+      // PEXT of the i-th permutation of the mask is exactly i.
+      m->magic = 0;
+      memcpy(m->attacks, references, sizeof(u64) * size);
+      attacks += size;
+      continue;
+    }
+    bool found = false;
+    while (!found) {
+      m->magic = magic_random_sparse(&rng_state);
+      if (pop_count((m->mask * m->magic) >> 56) < 6) {
+        continue;
+      }
+      // Epochs let us reuse the table between attempts without clearing it.
+      attempt++;
+      found = true;
+      for (i32 i = 0; i < size; i++) {
+        const u32 idx = magic_index(m, occupancies[i]);
+        if (epoch[idx] < attempt) {
+          epoch[idx] = attempt;
+          m->attacks[idx] = references[i];
+        } else if (m->attacks[idx] != references[i]) {
+          found = false;
+          break;
+        }
+      }
+    }
+    attacks += size;
+  }
+}
+
+static bool slider_attacks_verify(const u64 rays[4][64], Magic *magics) {
+  for (u32 sq = 0; sq < 64; sq++) {
+    Magic *m = &magics[sq];
+    const i32 bits = pop_count(m->mask);
+    for (i32 i = 0; i < (1 << bits); i++) {
+      const u64 occupancy = permute_mask(m->mask, i, bits);
+      if (m->attacks[slider_index(m, occupancy)] !=
+          slider_moves_slow(rays, sq, occupancy)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/**
+ * PEXT only pays off where it is implemented in hardware: AMD before Zen 3
+ * (family 0x19) microcodes it, and there it is far slower than a multiply.
+ */
+static bool cpu_has_fast_pext(void) {
+#if BLOBFISH_HAS_PEXT
+  u32 eax, ebx, ecx, edx;
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(ebx & (1 << 8))) {
+    return false;
+  }
+  __get_cpuid(0, &eax, &ebx, &ecx, &edx);
+  const bool amd = ebx == 0x68747541; // "Auth"enticAMD
+  __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+  u32 family = (eax >> 8) & 0xf;
+  if (family == 0xf) {
+    family += (eax >> 20) & 0xff;
+  }
+  return !(amd && family < 0x19);
+#else
+  return false;
+#endif
+}
+
+/**
+ * Must be called once before any move generation.
+ * Picks the PEXT backend if the CPU supports it, magics otherwise.
+ */
+void init_slider_attacks(void) {
+  slider_backend =
+      cpu_has_fast_pext() ? kSliderBackendPext : kSliderBackendMagic;
+  slider_attacks_generate(BITBOARD_BISHOP_RAYS, BISHOP_MAGICS,
+                          bishop_attack_table);
+  slider_attacks_generate(BITBOARD_ROOK_RAYS, ROOK_MAGICS, rook_attack_table);
+  if (!slider_attacks_verify(BITBOARD_BISHOP_RAYS, BISHOP_MAGICS) ||
+      !slider_attacks_verify(BITBOARD_ROOK_RAYS, ROOK_MAGICS)) {
+    printf("slider attack table self-check failed (%s)\n",
+           slider_backend_name());
+    exit(1);
+  }
+}
+
+const char *slider_backend_name(void) {
+  return slider_backend == kSliderBackendPext ? "pext" : "magic";
+}
+
+#undef BISHOP_TABLE_SIZE
+#undef ROOK_TABLE_SIZE
@@ -1,326 +1,277 @@
 #include "bitboard_constants.h"
 #include "chess.h"
+#include "move_generation.h"
+#include <assert.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 /*Intrinsics not working on Mac
     TODO: try using on Linux
 */
 /*#include <immintrin.h>*/
 
-typedef u32 (*bitscan_function)(u64);
-
-MoveList generate_all_pseudo_legal_moves(Board *board);
-
 u32 pop_lsb();
 
 /**
- * TODO: optimize
- * this is an important bottleneck in qsearch
+ * Everything the legal move generator needs to know about the side to move's
+ * king, computed once per position instead of once per move.
+ * check_mask holds the destinations that resolve a single check (capturing
+ * the checker or blocking), or every square when not in check.
  */
-MoveList generate_capture_moves_old(Board *board) {
-  MoveList captures = move_list_create();
-  MoveList legal = generate_all_legal_moves(board);
-  for (int i = 0; i < legal.count; i++) {
-    Move mv = move_list_get(&legal, i);
-    u32 md = move_get_metadata(mv);
-    if (md & CAPTURE_BIT_FLAG) {
-      move_list_push(&captures, mv);
-    }
-  }
-  return captures;
+typedef struct KingSafety {
+  u32 king_idx;
+  u64 checkers;
+  u64 pinned;
+  u64 check_mask;
+} KingSafety;
+
+/**
+ * All pieces of either color attacking square target_idx, given occupancy.
+ */
+static u64 square_attackers(u32 target_idx, u64 occupancy_mask,
+                            const u64 *bitboards) {
+  const u64 target_bit = (u64)1 << target_idx;
+  return (pawn_attacks(target_bit, kWhite) & bitboards[kBlack] &
+          bitboards[kPawn]) |
+         (pawn_attacks(target_bit, kBlack) & bitboards[kWhite] &
+          bitboards[kPawn]) |
+         (knight_moves(target_idx) & bitboards[kKnight]) |
+         (king_moves(target_idx) & bitboards[kKing]) |
+         (bishop_moves(target_idx, occupancy_mask) &
+          (bitboards[kBishop] | bitboards[kQueen])) |
+         (rook_moves(target_idx, occupancy_mask) &
+          (bitboards[kRook] | bitboards[kQueen]));
 }
 
-MoveList generate_capture_moves(Board *board) {
-    MoveList move_list = move_list_create();
-    const u64 friendly_mask = board->_bitboard[board->_turn];
-    const u64 enemy_mask = board->_bitboard[!board->_turn];
-    const u64 occupancy_mask = friendly_mask | enemy_mask;
-    // Knights
-    // https://www.chessprogramming.org/Knight_Pattern
-    // TODO: use conditional AVX instructions if possible
-    // hitting static data might be slow, idk
-    // Or even just shifting/adding offset
-    // must measure
-    u64 knights = friendly_mask & board->_bitboard[kKnight];
-    while (knights) {
-        const u32 idx = bitscan_forward(knights);
-        u64 jumps = knight_moves(idx) & enemy_mask;
-        while (jumps) {
-            const u32 dest_idx = bitscan_forward(jumps);
-            const u64 dest_bit = (u64)1 << dest_idx;
-            const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-            const Move mv = move_create(idx, dest_idx, md);
-            move_list_push(&move_list, mv);
-            jumps ^= dest_bit;
-        }
-        knights ^= (u64)1 << idx;
-    }
-    const u64 king = friendly_mask & board->_bitboard[kKing];
-    // Same note as for Knights w.r.t. optimization
-    if (king) { // technically this check isn't needed for legal positions
-        const u32 king_idx = bitscan_forward(king);
-        u64 king_move_bitset = king_moves(king_idx) & enemy_mask;
-        while (king_move_bitset) {
-            const u32 dest_idx = bitscan_forward(king_move_bitset);
-            const u64 dest_bit = (u64)1 << dest_idx;
-            const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-            const Move mv = move_create(king_idx, dest_idx, md);
-            move_list_push(&move_list, mv);
-            king_move_bitset ^= dest_bit;
-        }
-    }
-    // Pawns
-    const u64 pawns = friendly_mask & board->_bitboard[kPawn];
-    if (pawns) {
-        const u64 not_a_file = (u64) ~0x0101010101010101;
-        const u64 not_h_file = (u64) ~0x8080808080808080;
-        const u64 last_rank = 0xFF000000000000FF;
-        const u32 ep_idx =
-                board_metadata_get_en_passant_square(board_metadata_peek(board, 0));
-        const u64 en_passant_square = ep_idx == 0 ? 0 : (u64)1 << ep_idx;
-        u64 pawn_east_attacks;
-        u64 pawn_west_attacks;
-        // push
-        i32 east_offset;
-        i32 west_offset;
-        if (board->_turn == kWhite) {
-            pawn_east_attacks =
-                    ((pawns << 9) & not_a_file) & (en_passant_square | enemy_mask);
-            pawn_west_attacks =
-                    ((pawns << 7) & not_h_file) & (en_passant_square | enemy_mask);
-            east_offset = -9;
-            west_offset = -7;
-        } else {
-            pawn_east_attacks =
-                    ((pawns >> 7) & not_a_file) & (en_passant_square | enemy_mask);
-            pawn_west_attacks =
-                    ((pawns >> 9) & not_h_file) & (en_passant_square | enemy_mask);
-            east_offset = 7;
-            west_offset = 9;
-        }
-        while (pawn_east_attacks) {
-            const u32 dest_idx = bitscan_forward(pawn_east_attacks);
-            const u32 src_idx = ((i32)dest_idx) + east_offset;
-            const u64 dest_bit = (u64)1 << dest_idx;
-            if (dest_bit & last_rank) {
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kQueenCapturePromotionMove));
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kBishopCapturePromotionMove));
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kKnightCapturePromotionMove));
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kRookCapturePromotionMove));
-            } else {
-                const u32 flags =
-                        (dest_bit & en_passant_square) ? kEnPassantMove : kCaptureMove;
-                move_list_push(&move_list, move_create(src_idx, dest_idx, flags));
-            }
-            pawn_east_attacks ^= dest_bit;
-        }
-        while (pawn_west_attacks) {
-            const u32 dest_idx = bitscan_forward(pawn_west_attacks);
-            const u32 src_idx = ((i32)dest_idx) + west_offset;
-            const u64 dest_bit = (u64)1 << dest_idx;
-            if (dest_bit & last_rank) {
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kQueenCapturePromotionMove));
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kBishopCapturePromotionMove));
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kKnightCapturePromotionMove));
-                move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                                       kRookCapturePromotionMove));
-            } else {
-                u32 flags =
-                        (dest_bit & en_passant_square) ? kEnPassantMove : kCaptureMove;
-                move_list_push(&move_list, move_create(src_idx, dest_idx, flags));
-            }
-            pawn_west_attacks ^= dest_bit;
-        }
-    }
-    u64 bishops =
-            friendly_mask & (board->_bitboard[kBishop] | board->_bitboard[kQueen]);
-    while (bishops) {
-        const u32 src_idx = bitscan_forward(bishops);
-        u64 destinations = bishop_moves(src_idx, occupancy_mask) & enemy_mask;
-        while (destinations) {
-            const u32 dest_idx = bitscan_forward(destinations);
-            const u64 dest_bit = (u64)1 << dest_idx;
-            const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-            const Move mv = move_create(src_idx, dest_idx, md);
-            move_list_push(&move_list, mv);
-            destinations ^= dest_bit;
-        }
-        bishops ^= (u64)1 << src_idx;
-    }
-    u64 rooks =
-            friendly_mask & (board->_bitboard[kRook] | board->_bitboard[kQueen]);
-    while (rooks) {
-        const u32 src_idx = bitscan_forward(rooks);
-        u64 destinations = rook_moves(src_idx, occupancy_mask) & enemy_mask;
-        while (destinations) {
-            const u32 dest_idx = bitscan_forward(destinations);
-            const u64 dest_bit = (u64)1 << dest_idx;
-            const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-            const Move mv = move_create(src_idx, dest_idx, md);
-            move_list_push(&move_list, mv);
-            destinations ^= dest_bit;
-        }
-        rooks ^= (u64)1 << src_idx;
-    }
-    MoveList legal = move_list_create();
-    for (int i = 0; i < move_list.count; i++) {
-        u64 bitboards[8];
-        for (int k = 0; k < 8; k++) { // could be memcpy instead
-            bitboards[k] = board->_bitboard[k];
-        }
-        Move mv = move_list_get(&move_list, i);
-        bitboards_update(bitboards, board->_turn, mv);
-        if (!is_attacked(bitboards[board->_turn] & bitboards[kKing], bitboards,
-                         !board->_turn)) {
-            move_list_push(&legal, mv);
-        }
+static KingSafety king_safety(Board *board) {
+  KingSafety ks;
+  const u64 *bb = board->_bitboard;
+  const u64 friendly_mask = bb[board->_turn];
+  const u64 enemy_mask = bb[!board->_turn];
+  const u64 occupancy_mask = friendly_mask | enemy_mask;
+  ks.king_idx = bitscan_forward(friendly_mask & bb[kKing]);
+  ks.checkers =
+      square_attackers(ks.king_idx, occupancy_mask, bb) & enemy_mask;
+  ks.pinned = 0;
+  // Enemy sliders that would see the king on an empty board.
+  u64 snipers = ((rook_moves(ks.king_idx, 0) & (bb[kRook] | bb[kQueen])) |
+                 (bishop_moves(ks.king_idx, 0) & (bb[kBishop] | bb[kQueen]))) &
+                enemy_mask;
+  while (snipers) {
+    const u32 sniper_idx = bitscan_forward(snipers);
+    const u64 blockers =
+        BITBOARD_BETWEEN[ks.king_idx][sniper_idx] & occupancy_mask;
+    if (blockers && !(blockers & (blockers - 1))) {
+      ks.pinned |= blockers & friendly_mask;
     }
-    return legal;
+    snipers &= snipers - 1;
+  }
+  if (ks.checkers == 0) {
+    ks.check_mask = ~(u64)0;
+  } else {
+    const u32 checker_idx = bitscan_forward(ks.checkers);
+    ks.check_mask = BITBOARD_BETWEEN[ks.king_idx][checker_idx] | ks.checkers;
+  }
+  return ks;
 }
 
-/*
- * TODO: optimize
+/**
+ * A pinned piece may only move along the line through its king and pinner.
  */
-i32 board_legal_moves_count(Board *board) {
-  MoveList legal = generate_all_legal_moves(board);
-  return legal.count;
+static inline bool pin_allows(const KingSafety *ks, u32 src_idx,
+                              u32 dest_idx) {
+  return !((ks->pinned >> src_idx) & 1) ||
+         ((BITBOARD_LINE[ks->king_idx][src_idx] >> dest_idx) & 1);
 }
 
-/**
- * In the future, we might generate unchecking and/or special moves separately.
- */
-MoveList generate_all_legal_moves(Board *board) {
-  MoveList legal = move_list_create();
-  MoveList pseudo_legal = generate_all_pseudo_legal_moves(board);
-  for (int i = 0; i < pseudo_legal.count; i++) {
-    u64 bitboards[8];
-    for (int k = 0; k < 8; k++) { // could be memcpy instead
-      bitboards[k] = board->_bitboard[k];
-    }
-    Move mv = move_list_get(&pseudo_legal, i);
-    bitboards_update(bitboards, board->_turn, mv);
-    if (!is_attacked(bitboards[board->_turn] & bitboards[kKing], bitboards,
-                     !board->_turn)) {
-      move_list_push(&legal, mv);
-    }
+static void push_piece_moves(MoveList *move_list, u32 src_idx,
+                             u64 destinations, u64 enemy_mask) {
+  while (destinations) {
+    const u32 dest_idx = bitscan_forward(destinations);
+    const u64 dest_bit = (u64)1 << dest_idx;
+    const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
+    move_list_push(move_list, move_create(src_idx, dest_idx, md));
+    destinations ^= dest_bit;
   }
-  return legal;
 }
 
-bool board_is_check(Board *board) {
-  return is_attacked(board->_bitboard[board->_turn] & board->_bitboard[kKing],
-                     board->_bitboard, !board->_turn);
+static void push_pawn_moves(MoveList *move_list, const KingSafety *ks,
+                            u64 destinations, i32 offset, bool capture) {
+  const u64 last_rank = 0xFF000000000000FF;
+  while (destinations) {
+    const u32 dest_idx = bitscan_forward(destinations);
+    const u32 src_idx = ((i32)dest_idx) + offset;
+    const u64 dest_bit = (u64)1 << dest_idx;
+    destinations ^= dest_bit;
+    if (!pin_allows(ks, src_idx, dest_idx)) {
+      continue;
+    }
+    if (dest_bit & last_rank) {
+      if (capture) {
+        move_list_push(move_list, move_create(src_idx, dest_idx,
+                                              kQueenCapturePromotionMove));
+        move_list_push(move_list, move_create(src_idx, dest_idx,
+                                              kBishopCapturePromotionMove));
+        move_list_push(move_list, move_create(src_idx, dest_idx,
+                                              kKnightCapturePromotionMove));
+        move_list_push(move_list, move_create(src_idx, dest_idx,
+                                              kRookCapturePromotionMove));
+      } else {
+        move_list_push(move_list,
+                       move_create(src_idx, dest_idx, kQueenPromotionMove));
+        move_list_push(move_list,
+                       move_create(src_idx, dest_idx, kKnightPromotionMove));
+        move_list_push(move_list,
+                       move_create(src_idx, dest_idx, kBishopPromotionMove));
+        move_list_push(move_list,
+                       move_create(src_idx, dest_idx, kRookPromotionMove));
+      }
+    } else {
+      move_list_push(move_list, move_create(src_idx, dest_idx,
+                                            capture ? kCaptureMove
+                                                    : kQuietMove));
+    }
+  }
 }
 
-MoveList generate_all_pseudo_legal_moves(Board *board) {
-  MoveList move_list = move_list_create();
-  const u64 friendly_mask = board->_bitboard[board->_turn];
-  const u64 enemy_mask = board->_bitboard[!board->_turn];
-  const u64 occupancy_mask = friendly_mask | enemy_mask;
-  // Knights
-  // https://www.chessprogramming.org/Knight_Pattern
-  // TODO: use conditional AVX instructions if possible
-  // hitting static data might be slow, idk
-  // Or even just shifting/adding offset
-  // must measure
-  u64 knights = friendly_mask & board->_bitboard[kKnight];
-  while (knights) {
-    const u32 idx = bitscan_forward(knights);
-    u64 jumps = knight_moves(idx) & ~friendly_mask;
-    while (jumps) {
-      const u32 dest_idx = bitscan_forward(jumps);
-      const u64 dest_bit = (u64)1 << dest_idx;
-      const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-      const Move mv = move_create(idx, dest_idx, md);
-      move_list_push(&move_list, mv);
-      jumps ^= dest_bit;
-    }
-    knights ^= (u64)1 << idx;
+/**
+ * Legal castling moves, pushed onto move_list if it isn't NULL.
+ * Returns how many there are.
+ * TODO: generalized, 960 castling the rule is there's a king target square
+ * for all positions Since castling is defined where the DEST of king+rook is
+ * constant, we could encode the original king-original rook pos.
+ */
+static i32 castling_moves(Board *board, const KingSafety *ks,
+                          MoveList *move_list) {
+  if (ks->checkers) {
+    return 0;
   }
-  // Castling
-  // TODO: generalized, 960 castling the rule is there's a king target square
-  // for all positions Since castling is defined where the DEST of king+rook is
-  // constant, we could encode the original king-original rook pos.
-  const u64 king = friendly_mask & board->_bitboard[kKing];
-  if (king) {
-    BoardMetadata *md = board_metadata_peek(board, 0);
-    const u32 castling_rights = board_metadata_get_castling_rights(md);
-    if ((board->_turn == kWhite && !(castling_rights & kWhiteKingSideFlag)) ||
-        (board->_turn == kBlack && !(castling_rights & kBlackKingSideFlag))) {
-      const u32 king_dest = board->_turn == kWhite ? 6 : 62;
-      // 960: need to fix this
-      const u64 king_squares =
-          king | (king << 1) | (king << 2); // these must all not be attacked
-      const u64 must_be_empty_squares = king ^ king_squares;
-      if (!(must_be_empty_squares & occupancy_mask)) {
-        if (!is_attacked(king_squares, board->_bitboard, !board->_turn)) {
-          const Move mv = move_create(bitscan_forward(king), king_dest,
-                                      kKingSideCastleMove);
-          move_list_push(&move_list, mv);
+  i32 count = 0;
+  const i32 turn = board->_turn;
+  const u64 occupancy_mask = board->_bitboard[kWhite] | board->_bitboard[kBlack];
+  const u64 king = (u64)1 << ks->king_idx;
+  BoardMetadata *md = board_metadata_peek(board, 0);
+  const u32 castling_rights = board_metadata_get_castling_rights(md);
+  if ((turn == kWhite && !(castling_rights & kWhiteKingSideFlag)) ||
+      (turn == kBlack && !(castling_rights & kBlackKingSideFlag))) {
+    const u32 king_dest = turn == kWhite ? 6 : 62;
+    // 960: need to fix this
+    const u64 king_squares =
+        king | (king << 1) | (king << 2); // these must all not be attacked
+    const u64 must_be_empty_squares = king ^ king_squares;
+    if (!(must_be_empty_squares & occupancy_mask)) {
+      if (!is_attacked(king_squares, board->_bitboard, !turn)) {
+        if (move_list) {
+          move_list_push(move_list, move_create(ks->king_idx, king_dest,
+                                                kKingSideCastleMove));
         }
+        count++;
       }
     }
-    if ((board->_turn == kWhite && !(castling_rights & kWhiteQueenSideFlag)) ||
-        (board->_turn == kBlack && !(castling_rights & kBlackQueenSideFlag))) {
-      const u32 king_dest = board->_turn == kWhite ? 2 : 58;
-      // 960: need to fix this
-      const u64 king_squares = king | (king >> 1) | (king >> 2);
-      const u64 must_be_empty_squares = king ^ (king_squares | (king >> 3));
-      if (!(must_be_empty_squares & occupancy_mask)) {
-        if (!is_attacked(king_squares, board->_bitboard, !board->_turn)) {
-          const Move mv = move_create(bitscan_forward(king), king_dest,
-                                      kQueenSideCastleMove);
-          move_list_push(&move_list, mv);
+  }
+  if ((turn == kWhite && !(castling_rights & kWhiteQueenSideFlag)) ||
+      (turn == kBlack && !(castling_rights & kBlackQueenSideFlag))) {
+    const u32 king_dest = turn == kWhite ? 2 : 58;
+    // 960: need to fix this
+    const u64 king_squares = king | (king >> 1) | (king >> 2);
+    const u64 must_be_empty_squares = king ^ (king_squares | (king >> 3));
+    if (!(must_be_empty_squares & occupancy_mask)) {
+      if (!is_attacked(king_squares, board->_bitboard, !turn)) {
+        if (move_list) {
+          move_list_push(move_list, move_create(ks->king_idx, king_dest,
+                                                kQueenSideCastleMove));
         }
+        count++;
       }
     }
   }
+  return count;
+}
+
+/**
+ * En passant can expose the king along the rank of both pawns, which the pin
+ * masks don't see, so these are verified by making the move.
+ */
+static bool en_passant_is_legal(Board *board, Move mv) {
+  u64 bitboards[8];
+  memcpy(bitboards, board->_bitboard, sizeof(bitboards));
+  bitboards_update(bitboards, board->_turn, mv);
+  return !is_attacked(bitboards[board->_turn] & bitboards[kKing], bitboards,
+                      !board->_turn);
+}
+
+/**
+ * Legal move generator core, restricted to moves landing on target_mask.
+ * Passing the enemy pieces gives captures (en passant included), passing the
+ * empty squares gives quiet moves (castling included).
+ * Checkers and pins are computed once per position (see KingSafety), so apart
+ * from en passant, whose discovered checks along the rank are awkward to mask,
+ * no generated move needs to be verified. In double check only the king may
+ * move.
+ */
+static MoveList generate_legal_moves_to(Board *board, u64 target_mask) {
+  MoveList move_list = move_list_create();
+  const i32 turn = board->_turn;
+  const u64 friendly_mask = board->_bitboard[turn];
+  const u64 enemy_mask = board->_bitboard[!turn];
+  const u64 occupancy_mask = friendly_mask | enemy_mask;
+  const KingSafety ks = king_safety(board);
+  target_mask &= ~friendly_mask;
+  const u64 king = (u64)1 << ks.king_idx;
   // King
-  // Same note as for Knights w.r.t. optimization
-  if (king) { // technically this check isn't needed for legal positions
-    const u32 king_idx = bitscan_forward(king);
-    u64 king_move_bitset = king_moves(king_idx) & ~friendly_mask;
+  // Its destinations are tested with the king lifted off the board, so that
+  // it can't hide from a slider behind itself.
+  {
+    u64 bitboards[8];
+    memcpy(bitboards, board->_bitboard, sizeof(bitboards));
+    bitboards[turn] ^= king;
+    bitboards[kKing] ^= king;
+    u64 king_move_bitset = king_moves(ks.king_idx) & target_mask;
     while (king_move_bitset) {
       const u32 dest_idx = bitscan_forward(king_move_bitset);
       const u64 dest_bit = (u64)1 << dest_idx;
-      const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-      const Move mv = move_create(king_idx, dest_idx, md);
-      move_list_push(&move_list, mv);
+      if (!is_attacked(dest_bit, bitboards, !turn)) {
+        const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
+        move_list_push(&move_list, move_create(ks.king_idx, dest_idx, md));
+      }
       king_move_bitset ^= dest_bit;
     }
   }
+  if (ks.checkers & (ks.checkers - 1)) {
+    return move_list;
+  }
+  const u64 targets = target_mask & ks.check_mask;
+  // Castling
+  if (target_mask & ~occupancy_mask) {
+    castling_moves(board, &ks, &move_list);
+  }
+  // Knights
+  // https://www.chessprogramming.org/Knight_Pattern
+  // A pinned knight can never move.
+  u64 knights = friendly_mask & board->_bitboard[kKnight] & ~ks.pinned;
+  while (knights) {
+    const u32 idx = bitscan_forward(knights);
+    push_piece_moves(&move_list, idx, knight_moves(idx) & targets, enemy_mask);
+    knights &= knights - 1;
+  }
   // Pawns
   const u64 pawns = friendly_mask & board->_bitboard[kPawn];
   if (pawns) {
     const u64 empty_mask = ~occupancy_mask;
     const u64 not_a_file = (u64) ~0x0101010101010101;
     const u64 not_h_file = (u64) ~0x8080808080808080;
-    const u64 last_rank = 0xFF000000000000FF;
-    const u32 ep_idx =
-        board_metadata_get_en_passant_square(board_metadata_peek(board, 0));
-    const u64 en_passant_square = ep_idx == 0 ? 0 : (u64)1 << ep_idx;
     u64 pawn_east_attacks;
     u64 pawn_west_attacks;
     u64 pawn_jumps_single;
-    u64 pawn_double_push_destinations; // locations of pawns that can double
-    // push
+    u64 pawn_double_push_destinations;
     i32 east_offset;
     i32 west_offset;
     i32 pawn_jump_offset;
-    if (board->_turn == kWhite) {
+    if (turn == kWhite) {
       const u64 fourth_rank = 0x00000000FF000000;
-      pawn_east_attacks =
-          ((pawns << 9) & not_a_file) & (en_passant_square | enemy_mask);
-      pawn_west_attacks =
-          ((pawns << 7) & not_h_file) & (en_passant_square | enemy_mask);
+      pawn_east_attacks = ((pawns << 9) & not_a_file) & enemy_mask;
+      pawn_west_attacks = ((pawns << 7) & not_h_file) & enemy_mask;
       pawn_jumps_single = (pawns << 8) & empty_mask;
       east_offset = -9;
       west_offset = -7;
@@ -329,10 +280,8 @@ MoveList generate_all_pseudo_legal_moves(Board *board) {
           (pawn_jumps_single << 8) & empty_mask & fourth_rank;
     } else {
       const u64 fifth_rank = 0x000000FF00000000;
-      pawn_east_attacks =
-          ((pawns >> 7) & not_a_file) & (en_passant_square | enemy_mask);
-      pawn_west_attacks =
-          ((pawns >> 9) & not_h_file) & (en_passant_square | enemy_mask);
+      pawn_east_attacks = ((pawns >> 7) & not_a_file) & enemy_mask;
+      pawn_west_attacks = ((pawns >> 9) & not_h_file) & enemy_mask;
       east_offset = 7;
       west_offset = 9;
       pawn_jump_offset = 8;
@@ -340,103 +289,357 @@ MoveList generate_all_pseudo_legal_moves(Board *board) {
       pawn_double_push_destinations =
           (pawn_jumps_single >> 8) & empty_mask & fifth_rank;
     }
-    while (pawn_east_attacks) {
-      const u32 dest_idx = bitscan_forward(pawn_east_attacks);
-      const u32 src_idx = ((i32)dest_idx) + east_offset;
-      const u64 dest_bit = (u64)1 << dest_idx;
-      if (dest_bit & last_rank) {
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kQueenCapturePromotionMove));
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kBishopCapturePromotionMove));
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kKnightCapturePromotionMove));
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kRookCapturePromotionMove));
-      } else {
-        const u32 flags =
-            (dest_bit & en_passant_square) ? kEnPassantMove : kCaptureMove;
-        move_list_push(&move_list, move_create(src_idx, dest_idx, flags));
+    push_pawn_moves(&move_list, &ks, pawn_east_attacks & targets, east_offset,
+                    true);
+    push_pawn_moves(&move_list, &ks, pawn_west_attacks & targets, west_offset,
+                    true);
+    push_pawn_moves(&move_list, &ks, pawn_jumps_single & targets,
+                    pawn_jump_offset, false);
+    u64 doubles = pawn_double_push_destinations & targets;
+    while (doubles) {
+      const u32 dest_idx = bitscan_forward(doubles);
+      const u32 src_idx = ((i32)dest_idx) + pawn_jump_offset + pawn_jump_offset;
+      if (pin_allows(&ks, src_idx, dest_idx)) {
+        move_list_push(&move_list,
+                       move_create(src_idx, dest_idx, kDoublePawnMove));
       }
-      pawn_east_attacks ^= dest_bit;
+      doubles &= doubles - 1;
     }
-    while (pawn_west_attacks) {
-      const u32 dest_idx = bitscan_forward(pawn_west_attacks);
-      const u32 src_idx = ((i32)dest_idx) + west_offset;
-      const u64 dest_bit = (u64)1 << dest_idx;
-      if (dest_bit & last_rank) {
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kQueenCapturePromotionMove));
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kBishopCapturePromotionMove));
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kKnightCapturePromotionMove));
-        move_list_push(&move_list, move_create(src_idx, dest_idx,
-                                               kRookCapturePromotionMove));
-      } else {
-        u32 flags =
-            (dest_bit & en_passant_square) ? kEnPassantMove : kCaptureMove;
-        move_list_push(&move_list, move_create(src_idx, dest_idx, flags));
+    // En passant
+    const u32 ep_idx =
+        board_metadata_get_en_passant_square(board_metadata_peek(board, 0));
+    if (ep_idx != 0 && (target_mask & enemy_mask)) {
+      u64 ep_attackers = pawn_attacks((u64)1 << ep_idx, !turn) & pawns;
+      while (ep_attackers) {
+        const u32 src_idx = bitscan_forward(ep_attackers);
+        const Move mv = move_create(src_idx, ep_idx, kEnPassantMove);
+        if (en_passant_is_legal(board, mv)) {
+          move_list_push(&move_list, mv);
+        }
+        ep_attackers &= ep_attackers - 1;
       }
-      pawn_west_attacks ^= dest_bit;
     }
-    while (pawn_jumps_single) {
-      const u32 dest_idx = bitscan_forward(pawn_jumps_single);
-      const u32 src_idx = ((i32)dest_idx) + pawn_jump_offset;
-      const u64 dest_bit = (u64)1 << dest_idx;
-      if (dest_bit & last_rank) {
-        move_list_push(&move_list,
-                       move_create(src_idx, dest_idx, kQueenPromotionMove));
-        move_list_push(&move_list,
-                       move_create(src_idx, dest_idx, kKnightPromotionMove));
-        move_list_push(&move_list,
-                       move_create(src_idx, dest_idx, kBishopPromotionMove));
-        move_list_push(&move_list,
-                       move_create(src_idx, dest_idx, kRookPromotionMove));
-      } else {
-        move_list_push(&move_list, move_create(src_idx, dest_idx, kQuietMove));
-      }
-      pawn_jumps_single ^= dest_bit;
+  }
+  // Sliders
+  u64 bishops =
+      friendly_mask & (board->_bitboard[kBishop] | board->_bitboard[kQueen]);
+  while (bishops) {
+    const u32 src_idx = bitscan_forward(bishops);
+    u64 destinations = bishop_moves(src_idx, occupancy_mask) & targets;
+    if (ks.pinned & ((u64)1 << src_idx)) {
+      destinations &= BITBOARD_LINE[ks.king_idx][src_idx];
     }
-    while (pawn_double_push_destinations) {
-      const u32 dest_idx = bitscan_forward(pawn_double_push_destinations);
-      const u32 src_idx = ((i32)dest_idx) + pawn_jump_offset + pawn_jump_offset;
-      const Move mv = move_create(src_idx, dest_idx, kDoublePawnMove);
-      move_list_push(&move_list, mv);
-      pawn_double_push_destinations ^= (u64)1 << dest_idx;
+    push_piece_moves(&move_list, src_idx, destinations, enemy_mask);
+    bishops &= bishops - 1;
+  }
+  u64 rooks =
+      friendly_mask & (board->_bitboard[kRook] | board->_bitboard[kQueen]);
+  while (rooks) {
+    const u32 src_idx = bitscan_forward(rooks);
+    u64 destinations = rook_moves(src_idx, occupancy_mask) & targets;
+    if (ks.pinned & ((u64)1 << src_idx)) {
+      destinations &= BITBOARD_LINE[ks.king_idx][src_idx];
     }
+    push_piece_moves(&move_list, src_idx, destinations, enemy_mask);
+    rooks &= rooks - 1;
+  }
+  return move_list;
+}
+
+MoveList generate_all_legal_moves(Board *board) {
+  return generate_legal_moves_to(board, ~(u64)0);
+}
+
+MoveList generate_capture_moves(Board *board) {
+  return generate_legal_moves_to(board, board->_bitboard[!board->_turn]);
+}
+
+MoveList generate_quiet_moves(Board *board) {
+  return generate_legal_moves_to(
+      board, ~(board->_bitboard[kWhite] | board->_bitboard[kBlack]));
+}
+
+/**
+ * Only meaningful when in check, where it is every legal move. Kept as its
+ * own entry point so callers say what they expect.
+ */
+MoveList generate_evasion_moves(Board *board) {
+  assert(board_is_check(board));
+  return generate_legal_moves_to(board, ~(u64)0);
+}
+
+/**
+ * Number of pawn moves (en passant excluded) of pawns onto targets, each
+ * promotion counting once per piece.
+ */
+static i32 pawn_moves_count(u64 pawns, i32 turn, u64 enemy_mask,
+                            u64 empty_mask, u64 targets) {
+  const u64 not_a_file = (u64) ~0x0101010101010101;
+  const u64 not_h_file = (u64) ~0x8080808080808080;
+  const u64 last_rank = 0xFF000000000000FF;
+  u64 destination_sets[4];
+  if (turn == kWhite) {
+    const u64 fourth_rank = 0x00000000FF000000;
+    destination_sets[0] = ((pawns << 9) & not_a_file) & enemy_mask;
+    destination_sets[1] = ((pawns << 7) & not_h_file) & enemy_mask;
+    destination_sets[2] = (pawns << 8) & empty_mask;
+    destination_sets[3] = (destination_sets[2] << 8) & empty_mask & fourth_rank;
+  } else {
+    const u64 fifth_rank = 0x000000FF00000000;
+    destination_sets[0] = ((pawns >> 7) & not_a_file) & enemy_mask;
+    destination_sets[1] = ((pawns >> 9) & not_h_file) & enemy_mask;
+    destination_sets[2] = (pawns >> 8) & empty_mask;
+    destination_sets[3] = (destination_sets[2] >> 8) & empty_mask & fifth_rank;
+  }
+  i32 count = 0;
+  for (int i = 0; i < 4; i++) {
+    const u64 destinations = destination_sets[i] & targets;
+    count += pop_count(destinations & ~last_rank) +
+             4 * pop_count(destinations & last_rank);
+  }
+  return count;
+}
+
+/**
+ * Counts legal moves without generating them, using the same masks as
+ * generate_legal_moves_to. With stop_at_first, returns as soon as any legal
+ * move is found, which makes mate/stalemate detection cheap.
+ */
+static i32 legal_moves_scan(Board *board, bool stop_at_first) {
+  const i32 turn = board->_turn;
+  const u64 friendly_mask = board->_bitboard[turn];
+  const u64 enemy_mask = board->_bitboard[!turn];
+  const u64 occupancy_mask = friendly_mask | enemy_mask;
+  const KingSafety ks = king_safety(board);
+  const u64 king = (u64)1 << ks.king_idx;
+  i32 count = 0;
+  {
+    u64 bitboards[8];
+    memcpy(bitboards, board->_bitboard, sizeof(bitboards));
+    bitboards[turn] ^= king;
+    bitboards[kKing] ^= king;
+    u64 king_move_bitset = king_moves(ks.king_idx) & ~friendly_mask;
+    while (king_move_bitset) {
+      const u32 dest_idx = bitscan_forward(king_move_bitset);
+      if (!is_attacked((u64)1 << dest_idx, bitboards, !turn)) {
+        count++;
+        if (stop_at_first) {
+          return count;
+        }
+      }
+      king_move_bitset &= king_move_bitset - 1;
+    }
+  }
+  if (ks.checkers & (ks.checkers - 1)) {
+    return count;
+  }
+  const u64 targets = ~friendly_mask & ks.check_mask;
+  u64 knights = friendly_mask & board->_bitboard[kKnight] & ~ks.pinned;
+  while (knights) {
+    count += pop_count(knight_moves(bitscan_forward(knights)) & targets);
+    knights &= knights - 1;
   }
   u64 bishops =
       friendly_mask & (board->_bitboard[kBishop] | board->_bitboard[kQueen]);
   while (bishops) {
     const u32 src_idx = bitscan_forward(bishops);
-    u64 destinations = bishop_moves(src_idx, occupancy_mask) & ~friendly_mask;
-    while (destinations) {
-      const u32 dest_idx = bitscan_forward(destinations);
-      const u64 dest_bit = (u64)1 << dest_idx;
-      const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-      const Move mv = move_create(src_idx, dest_idx, md);
-      move_list_push(&move_list, mv);
-      destinations ^= dest_bit;
+    u64 destinations = bishop_moves(src_idx, occupancy_mask) & targets;
+    if (ks.pinned & ((u64)1 << src_idx)) {
+      destinations &= BITBOARD_LINE[ks.king_idx][src_idx];
     }
-    bishops ^= (u64)1 << src_idx;
+    count += pop_count(destinations);
+    bishops &= bishops - 1;
   }
   u64 rooks =
       friendly_mask & (board->_bitboard[kRook] | board->_bitboard[kQueen]);
   while (rooks) {
     const u32 src_idx = bitscan_forward(rooks);
-    u64 destinations = rook_moves(src_idx, occupancy_mask) & ~friendly_mask;
-    while (destinations) {
-      const u32 dest_idx = bitscan_forward(destinations);
-      const u64 dest_bit = (u64)1 << dest_idx;
-      const u32 md = (dest_bit & enemy_mask) ? kCaptureMove : kQuietMove;
-      const Move mv = move_create(src_idx, dest_idx, md);
-      move_list_push(&move_list, mv);
-      destinations ^= dest_bit;
+    u64 destinations = rook_moves(src_idx, occupancy_mask) & targets;
+    if (ks.pinned & ((u64)1 << src_idx)) {
+      destinations &= BITBOARD_LINE[ks.king_idx][src_idx];
     }
-    rooks ^= (u64)1 << src_idx;
+    count += pop_count(destinations);
+    rooks &= rooks - 1;
   }
-  return move_list;
+  if (stop_at_first && count) {
+    return count;
+  }
+  const u64 pawns = friendly_mask & board->_bitboard[kPawn];
+  count += pawn_moves_count(pawns & ~ks.pinned, turn, enemy_mask,
+                            ~occupancy_mask, targets);
+  u64 pinned_pawns = pawns & ks.pinned;
+  while (pinned_pawns) {
+    const u32 src_idx = bitscan_forward(pinned_pawns);
+    count += pawn_moves_count(
+        (u64)1 << src_idx, turn, enemy_mask, ~occupancy_mask,
+        targets & BITBOARD_LINE[ks.king_idx][src_idx]);
+    pinned_pawns &= pinned_pawns - 1;
+  }
+  if (stop_at_first && count) {
+    return count;
+  }
+  const u32 ep_idx =
+      board_metadata_get_en_passant_square(board_metadata_peek(board, 0));
+  if (ep_idx != 0) {
+    u64 ep_attackers = pawn_attacks((u64)1 << ep_idx, !turn) & pawns;
+    while (ep_attackers) {
+      const u32 src_idx = bitscan_forward(ep_attackers);
+      if (en_passant_is_legal(board,
+                              move_create(src_idx, ep_idx, kEnPassantMove))) {
+        count++;
+      }
+      ep_attackers &= ep_attackers - 1;
+    }
+  }
+  if (stop_at_first && count) {
+    return count;
+  }
+  // Castling is only legal if the king could also step to the next square,
+  // so it can't be the only legal move.
+  count += castling_moves(board, &ks, NULL);
+  return count;
+}
+
+i32 board_legal_moves_count(Board *board) {
+  return legal_moves_scan(board, false);
+}
+
+bool board_has_legal_move(Board *board) {
+  return legal_moves_scan(board, true) > 0;
+}
+
+/**
+ * Check a move that didn't come from the generator for this position (i.e.
+ * a transposition table or killer move) without generating every legal move.
+ * Castling and en passant are rare enough that we just fall back on the
+ * generator for them.
+ */
+bool board_is_move_legal(Board *board, Move mv) {
+  const i32 turn = board->_turn;
+  const u64 *bb = board->_bitboard;
+  const u64 friendly_mask = bb[turn];
+  const u64 enemy_mask = bb[!turn];
+  const u64 occupancy_mask = friendly_mask | enemy_mask;
+  const u64 src = move_get_src(mv);
+  const u64 dest = move_get_dest(mv);
+  const u32 src_idx = move_get_src_u32(mv);
+  const u32 md = move_get_metadata(mv);
+  if (mv == 0 || !(src & friendly_mask) || (dest & friendly_mask)) {
+    return false;
+  }
+  if (md == 0x6 || md == 0x7) { // unused encodings
+    return false;
+  }
+  if (md == kKingSideCastleMove || md == kQueenSideCastleMove ||
+      md == kEnPassantMove) {
+    MoveList legal = generate_all_legal_moves(board);
+    for (int i = 0; i < legal.count; i++) {
+      if (move_list_get(&legal, i) == mv) {
+        return true;
+      }
+    }
+    return false;
+  }
+  if (((md & CAPTURE_BIT_FLAG) != 0) != ((dest & enemy_mask) != 0)) {
+    return false;
+  }
+  if (src & bb[kPawn]) {
+    const u64 last_rank = 0xFF000000000000FF;
+    const u64 start_rank = turn == kWhite ? 0x000000000000FF00
+                                          : 0x00FF000000000000;
+    if (((md & PROMOTION_BIT_FLAG) != 0) != ((dest & last_rank) != 0)) {
+      return false;
+    }
+    if (md & CAPTURE_BIT_FLAG) {
+      if (!(pawn_attacks(src, turn) & dest)) {
+        return false;
+      }
+    } else if (md == kDoublePawnMove) {
+      const u64 single = pawn_forward_moves(src, turn);
+      if (!(src & start_rank) || (single & occupancy_mask) ||
+          pawn_forward_moves(single, turn) != dest) {
+        return false;
+      }
+    } else if (pawn_forward_moves(src, turn) != dest) {
+      return false;
+    }
+  } else {
+    u64 attacks = 0;
+    if (md != kQuietMove && md != kCaptureMove) {
+      return false;
+    }
+    if (src & bb[kKnight]) {
+      attacks = knight_moves(src_idx);
+    } else if (src & bb[kKing]) {
+      attacks = king_moves(src_idx);
+    } else {
+      if (src & (bb[kBishop] | bb[kQueen])) {
+        attacks |= bishop_moves(src_idx, occupancy_mask);
+      }
+      if (src & (bb[kRook] | bb[kQueen])) {
+        attacks |= rook_moves(src_idx, occupancy_mask);
+      }
+    }
+    if (!(attacks & dest)) {
+      return false;
+    }
+  }
+  u64 bitboards[8];
+  memcpy(bitboards, board->_bitboard, sizeof(bitboards));
+  bitboards_update(bitboards, turn, mv);
+  return !is_attacked(bitboards[turn] & bitboards[kKing], bitboards, !turn);
+}
+
+/**
+ * Whether mv, played by the side to move, checks the opponent, without
+ * making it: either the moved piece attacks the king from its destination,
+ * or vacating the source uncovers one of our sliders. Castling, en passant
+ * and promotions move more than one piece, so those are played out on a copy
+ * of the bitboards instead.
+ */
+bool board_move_gives_check(Board *board, Move mv) {
+  const i32 turn = board->_turn;
+  const u64 *bb = board->_bitboard;
+  const u64 enemy_king = bb[!turn] & bb[kKing];
+  const u32 md = move_get_metadata(mv);
+  if (md == kKingSideCastleMove || md == kQueenSideCastleMove ||
+      md == kEnPassantMove || (md & PROMOTION_BIT_FLAG)) {
+    u64 bitboards[8];
+    memcpy(bitboards, bb, sizeof(bitboards));
+    bitboards_update(bitboards, turn, mv);
+    return is_attacked(enemy_king, bitboards, turn);
+  }
+  const u64 src = move_get_src(mv);
+  const u64 dest = move_get_dest(mv);
+  const u32 dest_idx = move_get_dest_u32(mv);
+  const u32 king_idx = bitscan_forward(enemy_king);
+  const u64 occupancy = ((bb[kWhite] | bb[kBlack]) ^ src) | dest;
+  u64 direct = 0;
+  if (src & bb[kPawn]) {
+    direct = pawn_attacks(dest, turn);
+  } else if (src & bb[kKnight]) {
+    direct = knight_moves(dest_idx);
+  } else if (src & (bb[kBishop] | bb[kRook] | bb[kQueen])) {
+    if (src & (bb[kBishop] | bb[kQueen])) {
+      direct |= bishop_moves(dest_idx, occupancy);
+    }
+    if (src & (bb[kRook] | bb[kQueen])) {
+      direct |= rook_moves(dest_idx, occupancy);
+    }
+  }
+  if (direct & enemy_king) {
+    return true;
+  }
+  const u64 our_sliders = bb[turn] & ~src;
+  return ((bishop_moves(king_idx, occupancy) & our_sliders &
+           (bb[kBishop] | bb[kQueen])) |
+          (rook_moves(king_idx, occupancy) & our_sliders &
+           (bb[kRook] | bb[kQueen]))) != 0;
+}
+
+bool board_is_check(Board *board) {
+  return is_attacked(board->_bitboard[board->_turn] & board->_bitboard[kKing],
+                     board->_bitboard, !board->_turn);
 }
 
 /**
@@ -491,6 +694,96 @@ i32 attacker_count(u64 bitset, u64 *bitboards, i32 attacking_color) {
   return pop_count(attackers);
 }
 
+/**
+ * Piece values for static exchange evaluation, indexed by enum Piece.
+ */
+static const i32 SEE_PIECE_VALUES[8] = {0, 0, 100, 300, 300, 500, 900, 20000};
+
+/**
+ * Least valuable first. Bishops and knights are worth the same to SEE.
+ */
+static const i32 SEE_ATTACKER_ORDER[6] = {kPawn,  kKnight, kBishop,
+                                          kRook,  kQueen,  kKing};
+
+/**
+ * Static exchange evaluation: the material mv wins (or, if negative, loses)
+ * once both sides have made every profitable recapture on its destination,
+ * always recapturing with their least valuable piece. Sliders hidden behind
+ * a piece that has captured join in as x-rays. Pins are ignored.
+ * The whole capture sequence is played out first; the backward pass then
+ * lets either side stop capturing wherever that is better for it.
+ * https://www.chessprogramming.org/SEE_-_The_Swap_Algorithm
+ */
+i32 static_exchange_evaluation(Board *board, Move mv) {
+  const u64 *bitboards = board->_bitboard;
+  const u32 move_metadata = move_get_metadata(mv);
+  if (move_metadata == kKingSideCastleMove ||
+      move_metadata == kQueenSideCastleMove) {
+    return 0;
+  }
+  const u32 src_idx = move_get_src_u32(mv);
+  const u32 dest_idx = move_get_dest_u32(mv);
+  const u64 src = (u64)1 << src_idx;
+  const u64 dest = (u64)1 << dest_idx;
+  u64 occupancy = (bitboards[kWhite] | bitboards[kBlack]) ^ src;
+  i32 victim = 0;
+  i32 piece_on_dest = 0;
+  for (i32 p = kPawn; p <= kKing; p++) {
+    if (bitboards[p] & dest) {
+      victim = p;
+    }
+    if (bitboards[p] & src) {
+      piece_on_dest = p;
+    }
+  }
+  if (move_metadata == kEnPassantMove) {
+    victim = kPawn;
+    occupancy ^= board->_turn == kWhite ? dest >> 8 : dest << 8;
+  }
+  i32 gain[32];
+  gain[0] = SEE_PIECE_VALUES[victim];
+  if (move_metadata & PROMOTION_BIT_FLAG) {
+    static const i32 promotions[4] = {kKnight, kBishop, kRook, kQueen};
+    piece_on_dest = promotions[move_metadata & 0x3];
+    gain[0] += SEE_PIECE_VALUES[piece_on_dest] - SEE_PIECE_VALUES[kPawn];
+  }
+  const u64 diagonal_sliders = bitboards[kBishop] | bitboards[kQueen];
+  const u64 straight_sliders = bitboards[kRook] | bitboards[kQueen];
+  u64 attackers = square_attackers(dest_idx, occupancy, bitboards) & occupancy;
+  i32 side = !board->_turn;
+  i32 depth = 0;
+  while (depth < 31) {
+    const u64 side_attackers = attackers & bitboards[side];
+    if (!side_attackers) {
+      break;
+    }
+    i32 attacker = 0;
+    for (i32 i = 0; i < 6; i++) {
+      if (side_attackers & bitboards[SEE_ATTACKER_ORDER[i]]) {
+        attacker = SEE_ATTACKER_ORDER[i];
+        break;
+      }
+    }
+    if (attacker == kKing && (attackers & bitboards[!side])) {
+      break; // the king can't recapture onto a defended square
+    }
+    depth++;
+    gain[depth] = SEE_PIECE_VALUES[piece_on_dest] - gain[depth - 1];
+    occupancy ^= (u64)1 << bitscan_forward(side_attackers & bitboards[attacker]);
+    attackers |= (bishop_moves(dest_idx, occupancy) & diagonal_sliders) |
+                 (rook_moves(dest_idx, occupancy) & straight_sliders);
+    attackers &= occupancy;
+    piece_on_dest = attacker;
+    side = !side;
+  }
+  while (depth > 0) {
+    const i32 captured = gain[depth];
+    depth--;
+    gain[depth] = -gain[depth] > captured ? gain[depth] : -captured;
+  }
+  return gain[0];
+}
+
 /**
  * note this requires bitset instead of flat index
  * TODO: verify this works for *entire* pawn set and not only single bitset?
@@ -520,33 +813,11 @@ u64 king_moves(u32 source_idx) { return BITBOARD_KING_ATTACKS[source_idx]; }
 u64 knight_moves(u32 source_idx) { return BITBOARD_KNIGHT_ATTACKS[source_idx]; }
 
 u64 bishop_moves(u32 source_idx, u64 occupancy_mask) {
-  static bitscan_function bitscan_fns[4] = {bitscan_forward, bitscan_forward,
-                                            bitscan_reverse, bitscan_reverse};
-  u64 result = 0;
-  for (i32 direction = 0; direction < 4; direction++) {
-    const u64 ray = BITBOARD_BISHOP_RAYS[direction][source_idx];
-    const u64 overlaps = ray & occupancy_mask;
-    result |= ray;
-    if (overlaps) {
-      result &=
-          ~(BITBOARD_BISHOP_RAYS[direction][bitscan_fns[direction](overlaps)]);
-    }
-  }
-  return result;
+  const Magic *m = &BISHOP_MAGICS[source_idx];
+  return m->attacks[slider_index(m, occupancy_mask)];
 }
 
 u64 rook_moves(u32 source_idx, u64 occupancy_mask) {
-  static bitscan_function bitscan_fns[4] = {bitscan_forward, bitscan_forward,
-                                            bitscan_reverse, bitscan_reverse};
-  u64 result = 0;
-  for (i32 direction = 0; direction < 4; direction++) {
-    const u64 ray = BITBOARD_ROOK_RAYS[direction][source_idx];
-    const u64 overlaps = ray & occupancy_mask;
-    result |= ray;
-    if (overlaps) {
-      result &=
-          ~(BITBOARD_ROOK_RAYS[direction][bitscan_fns[direction](overlaps)]);
-    }
-  }
-  return result;
+  const Magic *m = &ROOK_MAGICS[source_idx];
+  return m->attacks[slider_index(m, occupancy_mask)];
 }
@@ -1,6 +1,17 @@
 #pragma once
-// CAN WE DELETE THIS???
-// actually, we might need for magics later on
+
+#include "chess.h"
+
+/*
+ * BMI2 PEXT is emitted with inline assembly rather than the intrinsic, so the
+ * rest of the engine doesn't need to be compiled with -mbmi2. It is only
+ * executed once init_slider_attacks has confirmed CPU support.
+ */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BLOBFISH_HAS_PEXT 1
+#else
+#define BLOBFISH_HAS_PEXT 0
+#endif
 
 enum RookDirection {
   kNorth,
@@ -15,3 +26,45 @@ enum BishopDirection {
   kSouthEast,
   kSouthWest,
 };
+
+enum SliderBackend {
+  kSliderBackendMagic,
+  kSliderBackendPext,
+};
+
+/**
+ * Slider attack table entry for one square.
+ * https://www.chessprogramming.org/Magic_Bitboards#Fancy
+ * mask holds the relevant occupancy (rays minus the board edge), and attacks
+ * points into a shared table that is indexed by either the magic hash or the
+ * PEXT of the masked occupancy, depending on the active backend.
+ */
+typedef struct Magic {
+  u64 mask;
+  u64 magic;
+  u64 *attacks;
+  u32 shift;
+} Magic;
+
+extern Magic BISHOP_MAGICS[64];
+
+extern Magic ROOK_MAGICS[64];
+
+extern i32 slider_backend;
+
+static inline u32 magic_index(const Magic *m, u64 occupancy_mask) {
+  return (u32)(((occupancy_mask & m->mask) * m->magic) >> m->shift);
+}
+
+static inline u32 slider_index(const Magic *m, u64 occupancy_mask) {
+#if BLOBFISH_HAS_PEXT
+  if (slider_backend == kSliderBackendPext) {
+    u64 index;
+    __asm__("pextq %2, %1, %0"
+            : "=r"(index)
+            : "r"(occupancy_mask), "r"(m->mask));
+    return (u32)index;
+  }
+#endif
+  return magic_index(m, occupancy_mask);
+}
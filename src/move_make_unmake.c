@@ -2,6 +2,8 @@
 #include "chess.h"
 #include <assert.h>
 
+void (*board_hash_prefetch)(u64 hash) = NULL;
+
 /**
  * Update hash based on piece movement. Don't update any other hash components.
  */
@@ -181,7 +183,7 @@ void board_make_move(Board *board, Move mv) {
         md->_halfmove_counter = 0;
     } else {
         md->_is_irreversible_move = false;
-        md->_halfmove_counter += 1;
+        md->_halfmove_counter = prev_md->_halfmove_counter + 1;
     }
     hash_update_pieces(board->_bitboard, board->_turn, mv, hash);
     {
@@ -273,6 +275,9 @@ void board_make_move(Board *board, Move mv) {
     }
     (*hash) ^=
             ZOBRIST_KEYS[ZOBRIST_BLACK_TO_MOVE]; // alternating in-out each half-move
+    if (board_hash_prefetch) {
+        board_hash_prefetch(*hash);
+    }
     bitboards_update(board->_bitboard, board->_turn, mv);
     md->_last_move = mv;
     board->_turn = !board->_turn;
@@ -303,11 +308,58 @@ void board_make_move(Board *board, Move mv) {
     }
 }
 
+/**
+ * Passes the turn without moving a piece, for null move pruning. Castling
+ * rights carry over, the en passant square is cleared. The null move counts
+ * as irreversible so repetition detection never looks across it: positions
+ * before it were reached with the other side to move.
+ */
+void board_make_null_move(Board *board) {
+    BoardMetadata *md = &board->_state_stack[board->_ply];
+    BoardMetadata *prev_md = board_metadata_peek(board, 0);
+    u64 *hash = &md->_hash;
+    *hash = prev_md->_hash;
+    if (board->_turn == kBlack) {
+        board->_fullmove_counter += 1;
+    }
+    const u32 prev_ep_square = board_metadata_get_en_passant_square(prev_md);
+    if (prev_ep_square > 0) {
+        const i32 col = (i32) prev_ep_square % 8;
+        *hash ^= ZOBRIST_KEYS[ZOBRIST_EN_PASSANT + col];
+    }
+    board_metadata_set_en_passant_square(md, 0);
+    board_metadata_set_castling_rights(
+            md, board_metadata_get_castling_rights(prev_md));
+    board_metadata_set_captured_piece(md, 0);
+    (*hash) ^= ZOBRIST_KEYS[ZOBRIST_BLACK_TO_MOVE];
+    if (board_hash_prefetch) {
+        board_hash_prefetch(*hash);
+    }
+    md->_halfmove_counter = prev_md->_halfmove_counter + 1;
+    md->_is_irreversible_move = true;
+    md->_is_repetition = false;
+    md->_last_move = 0;
+    board->_turn = !board->_turn;
+    board->_ply++;
+}
+
+void board_unmake_null_move(Board *board) {
+    assert(board->_ply > 0);
+    assert(board_metadata_peek(board, 0)->_last_move == 0);
+    if (board->_turn == kWhite) {
+        board->_fullmove_counter -= 1;
+    }
+    board->_turn = !board->_turn;
+    board->_ply--;
+}
+
 void board_unmake(Board *board) {
     // TODO: some more optional (?) assertions for unmake
     assert(board->_ply > 0);
     BoardMetadata *md = board_metadata_peek(board, 0);
-    if (board->_turn == kBlack) {
+    // _turn is still the side that did not make the move: the counter was
+    // bumped by a black move, so white is to move now.
+    if (board->_turn == kWhite) {
         board->_fullmove_counter -= 1;
     }
     const Move mv = md->_last_move;
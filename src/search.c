@@ -5,10 +5,38 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
 TranspositionTable tt;
-KillerTable killer_table;
 
-TTableBucket *ttable_probe(u64 hash); // TODO
+
+/**
+ * Per-thread search state for Lazy SMP. Each thread searches its own copy of
+ * the board with its own move ordering tables; only tt is shared.
+ * Thread 0 is the main thread, whose result is the one that gets played.
+ */
+typedef struct SearchThread {
+    i32 id;
+    Board *board;
+    OrderingTables *ordering;
+    i32 root_ply; // board->_ply at the root of the current search
+    u64 nodes;
+    AtomicBool *stop;
+    int depth_limit;
+} SearchThread;
+
+static SearchThread *search_threads;
+static i32 search_thread_count;
+static bool tt_prefetch_enabled = true;
+static u64 search_node_limit; // main thread nodes per search, 0 for no limit
+
+static void ttable_prefetch(u64 hash);
 
 typedef struct SearchArguments {
     Board *board;
@@ -16,7 +44,10 @@ typedef struct SearchArguments {
     Centipawns beta;
     i32 ply_depth;
     AtomicBool *stop;
-    u64 *nodes_searched;
+    SearchThread *thread;
+    bool allow_null_move; // false right after a null move, and when verifying one
+    Move excluded_move;   // skipped by singular extension's exclusion search
+    i32 extensions;       // plies of extension on the path from the root
 } SearchArguments;
 
 typedef struct ScoredMove {
@@ -32,8 +63,8 @@ typedef struct ScoredMoveList {
 
 Centipawns search_recursive(SearchArguments args);
 
-Centipawns qsearch(Board *board, Centipawns alpha, Centipawns beta,
-                   AtomicBool *stop);
+Centipawns qsearch(SearchThread *thread, Board *board, Centipawns alpha,
+                   Centipawns beta, AtomicBool *stop);
 
 Move pop_max(ScoredMoveList *scored_moves);
 
@@ -44,27 +75,332 @@ Centipawns min_cp(Centipawns x, Centipawns y) { return x < y ? x : y; }
 Centipawns max_cp(Centipawns x, Centipawns y) { return x > y ? x : y; }
 
 /**
- * Root search
- * TODO: put depth limit on as well
+ * Score for the side to move being checkmated. Mates closer to the root score
+ * worse, so the winning side prefers the quickest one.
+ */
+Centipawns mated_score(Board *board) {
+    return MIN_EVAL + (i32) board->_ply;
+}
+
+/**
+ * Rough piece values, only used to order moves.
+ */
+static const i32 ORDERING_PIECE_VALUES[8] = {0, 0, 100, 300, 300, 500, 900,
+                                             10000};
+
+static i32 piece_on_square(Board *board, u64 square) {
+    for (i32 p = kPawn; p <= kKing; p++) {
+        if (board->_bitboard[p] & square) {
+            return p;
+        }
+    }
+    return 0;
+}
+
+enum MovePickerStage {
+    kStageTTMove,
+    kStageGenerateCaptures,
+    kStageGoodCaptures,
+    kStageKillers,
+    kStageGenerateQuiets,
+    kStageQuiets,
+    kStageBadCaptures,
+    kStageDone,
+};
+
+/**
+ * Ordering bonuses for quiet moves, above any history score.
+ */
+static const i32 PROMOTION_ORDERING_SCORE = 1 << 21;
+static const i32 COUNTERMOVE_ORDERING_SCORE = 1 << 20;
+
+/**
+ * The piece and destination of the move that led to the current position,
+ * which countermoves and continuation history are keyed on. piece is 0 after
+ * a null move, or when the position was set up without moves.
  */
-void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
-            FILE *outfile, int depth_limit) {
-    // TODO: multi threading
+typedef struct PreviousMove {
+    i32 piece;
+    u32 to;
+} PreviousMove;
+
+static PreviousMove previous_move(Board *board) {
+    PreviousMove prev = {0, 0};
+    const Move mv = board_metadata_peek(board, 0)->_last_move;
+    if (mv != 0) {
+        prev.piece = piece_on_square(board, move_get_dest(mv));
+        prev.to = move_get_dest_u32(mv);
+    }
+    return prev;
+}
+
+/**
+ * Distance from the root of the current search, which killers are indexed by.
+ */
+static inline i32 search_ply(const SearchThread *thread, const Board *board) {
+    return (i32) board->_ply - thread->root_ply;
+}
+
+static bool is_killer_move(const SearchThread *thread, Board *board, Move mv) {
+    const i32 ply = search_ply(thread, board);
+    if (ply >= MAX_SEARCH_PLY) {
+        return false;
+    }
+    for (i32 i = 0; i < KILLER_SLOTS; i++) {
+        if (thread->ordering->killers[ply][i] == mv) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Hands out the moves of a position lazily, in order: TT move, good captures,
+ * killers, the other quiets (countermove first, then by history), then bad
+ * captures. A stage is only generated once the previous one runs out, so a
+ * cut-node that fails high on the TT move or a killer never generates or
+ * sorts the quiet moves.
+ */
+typedef struct MovePicker {
+    Board *board;
+    const OrderingTables *ordering;
+    Move killers[KILLER_SLOTS];
+    Move countermove;
+    PreviousMove prev;
+    i32 stage;
+    i32 picked; // moves already taken from the current stage's list
+    Move tt_move;
+    ScoredMoveList good_captures;
+    ScoredMoveList bad_captures;
+    ScoredMoveList quiets;
+} MovePicker;
+
+void move_picker_init(MovePicker *mp, Board *board, const SearchThread *thread,
+                      Move tt_move) {
+    const i32 ply = search_ply(thread, board);
+    mp->board = board;
+    mp->ordering = thread->ordering;
+    for (i32 i = 0; i < KILLER_SLOTS; i++) {
+        mp->killers[i] =
+                ply < MAX_SEARCH_PLY ? thread->ordering->killers[ply][i] : 0;
+    }
+    mp->prev = previous_move(board);
+    mp->countermove = mp->prev.piece
+                              ? thread->ordering->countermoves[board->_turn]
+                                                              [mp->prev.piece]
+                                                              [mp->prev.to]
+                              : 0;
+    mp->stage = kStageTTMove;
+    mp->picked = 0;
+    mp->tt_move = tt_move;
+    mp->good_captures.count = 0;
+    mp->bad_captures.count = 0;
+    mp->quiets.count = 0;
+}
+
+static void scored_move_list_push(ScoredMoveList *list, Move mv, i32 score) {
+    list->items[list->count].mv = mv;
+    list->items[list->count].score = score;
+    list->items[list->count].valid = true;
+    list->count++;
+}
+
+/**
+ * Captures are ordered by MVV-LVA. A capture is "bad" when it loses material
+ * by static exchange evaluation; those are tried after the quiet moves.
+ */
+static void move_picker_generate_captures(MovePicker *mp) {
+    Board *board = mp->board;
+    MoveList captures = generate_capture_moves(board);
+    for (i32 i = 0; i < captures.count; i++) {
+        Move mv = move_list_get(&captures, i);
+        if (mv == mp->tt_move) {
+            continue;
+        }
+        const i32 attacker = piece_on_square(board, move_get_src(mv));
+        const i32 victim = move_get_metadata(mv) == kEnPassantMove
+                                   ? kPawn
+                                   : piece_on_square(board, move_get_dest(mv));
+        const i32 score = (victim * 10) + (10 - attacker);
+        // Only a capture of a cheaper piece can lose material.
+        if (ORDERING_PIECE_VALUES[attacker] > ORDERING_PIECE_VALUES[victim] &&
+            static_exchange_evaluation(board, mv) < 0) {
+            scored_move_list_push(&mp->bad_captures, mv, score);
+        } else {
+            scored_move_list_push(&mp->good_captures, mv, score);
+        }
+    }
+}
+
+static i32 quiet_ordering_score(const MovePicker *mp, Move mv, u32 md) {
+    if (md & PROMOTION_BIT_FLAG) {
+        return PROMOTION_ORDERING_SCORE;
+    }
+    if (mv == mp->countermove) {
+        return COUNTERMOVE_ORDERING_SCORE;
+    }
+    Board *board = mp->board;
+    const u32 from = move_get_src_u32(mv);
+    const u32 to = move_get_dest_u32(mv);
+    i32 score = mp->ordering->history[board->_turn][from][to];
+    if (mp->prev.piece) {
+        const i32 piece = piece_on_square(board, move_get_src(mv));
+        score += mp->ordering->continuation[board->_turn][mp->prev.piece]
+                                           [mp->prev.to][piece][to];
+    }
+    return score;
+}
+
+static bool move_picker_is_killer(const MovePicker *mp, Move mv) {
+    for (i32 i = 0; i < KILLER_SLOTS; i++) {
+        if (mv == mp->killers[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void move_picker_generate_quiets(MovePicker *mp) {
+    Board *board = mp->board;
+    MoveList quiet_moves = generate_quiet_moves(board);
+    for (i32 i = 0; i < quiet_moves.count; i++) {
+        Move mv = move_list_get(&quiet_moves, i);
+        const u32 md = move_get_metadata(mv);
+        if (mv == mp->tt_move || move_picker_is_killer(mp, mv)) {
+            continue; // already handed out by an earlier stage
+        }
+        scored_move_list_push(&mp->quiets, mv, quiet_ordering_score(mp, mv, md));
+    }
+}
+
+/**
+ * Returns the next move to search, or 0 once every legal move has been
+ * handed out.
+ */
+Move move_picker_next(MovePicker *mp) {
+    switch (mp->stage) {
+        case kStageTTMove:
+            mp->stage = kStageGenerateCaptures;
+            if (mp->tt_move && board_is_move_legal(mp->board, mp->tt_move)) {
+                return mp->tt_move;
+            }
+            mp->tt_move = 0;
+            // fall through
+        case kStageGenerateCaptures:
+            move_picker_generate_captures(mp);
+            mp->stage = kStageGoodCaptures;
+            mp->picked = 0;
+            // fall through
+        case kStageGoodCaptures:
+            if (mp->picked < mp->good_captures.count) {
+                mp->picked++;
+                return pop_max(&mp->good_captures);
+            }
+            mp->stage = kStageKillers;
+            mp->picked = 0;
+            // fall through
+        case kStageKillers:
+            // Killers come from other positions at this ply, so they are
+            // checked for legality instead of generated.
+            while (mp->picked < KILLER_SLOTS) {
+                const Move killer = mp->killers[mp->picked++];
+                if (killer && killer != mp->tt_move &&
+                    board_is_move_legal(mp->board, killer)) {
+                    return killer;
+                }
+            }
+            mp->stage = kStageGenerateQuiets;
+            // fall through
+        case kStageGenerateQuiets:
+            move_picker_generate_quiets(mp);
+            mp->stage = kStageQuiets;
+            mp->picked = 0;
+            // fall through
+        case kStageQuiets:
+            if (mp->picked < mp->quiets.count) {
+                mp->picked++;
+                return pop_max(&mp->quiets);
+            }
+            mp->stage = kStageBadCaptures;
+            mp->picked = 0;
+            // fall through
+        case kStageBadCaptures:
+            if (mp->picked < mp->bad_captures.count) {
+                mp->picked++;
+                return pop_max(&mp->bad_captures);
+            }
+            mp->stage = kStageDone;
+            // fall through
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Helper threads skip some iterations so that they don't all search the same
+ * depth at the same time. Pattern from Stockfish's Lazy SMP.
+ */
+#define HELPER_SKIP_PATTERNS 20
+static const i32 HELPER_SKIP_SIZE[HELPER_SKIP_PATTERNS] = {
+        1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+static const i32 HELPER_SKIP_PHASE[HELPER_SKIP_PATTERNS] = {
+        0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+static bool helper_skips_depth(SearchThread *thread, int depth) {
+    if (thread->id == 0) {
+        return false;
+    }
+    const i32 pattern = (thread->id - 1) % HELPER_SKIP_PATTERNS;
+    return ((depth + HELPER_SKIP_PHASE[pattern]) / HELPER_SKIP_SIZE[pattern]) % 2;
+}
+
+static u64 search_nodes_total(void) {
+    u64 nodes = 0;
+    for (i32 t = 0; t < search_thread_count; t++) {
+        nodes += search_threads[t].nodes;
+    }
+    return nodes;
+}
+
+/**
+ * Searches the position after a move, with the window given from the point of
+ * view of the side that made it, and returns the score for that side.
+ */
+static Centipawns search_child(const SearchArguments *args, Centipawns alpha,
+                               Centipawns beta, i32 ply_depth) {
+    SearchArguments sub_args = *args;
+    sub_args.alpha = -beta;
+    sub_args.beta = -alpha;
+    sub_args.ply_depth = ply_depth;
+    sub_args.allow_null_move = true;
+    sub_args.excluded_move = 0;
+    return -search_recursive(sub_args);
+}
+
+/**
+ * Iterative deepening on one thread.
+ */
+static void search_iterative(SearchThread *thread, Move *best_move,
+                             AtomicBool *stop_thinking, FILE *outfile,
+                             int depth_limit) {
     // TODO: allow search subset of moves (this is a UCI requirement but rarely seen)
     // TODO: don't return best move in recursive impl, use root node search
     // TODO: do we alpha-beta prune at root? why or why not?
     struct timespec start;
     clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+    Board *board = thread->board;
+    // Killers are only meaningful relative to this root; history carries over.
+    thread->root_ply = (i32) board->_ply;
+    memset(thread->ordering->killers, 0, sizeof(thread->ordering->killers));
     MoveList legal_moves = generate_all_legal_moves(board);
     int ply_depth = 0;
-    u64 nodes_searched = 0;
     ScoredMoveList scored_moves;
     scored_moves.count = 0;
     u64 hash = board_metadata_peek(board, 0)->_hash;
-    TTableBucket *bucket_ptr = ttable_probe(hash);
+    TTableBucket root_bucket = ttable_load(hash);
     Move tt_move = 0;
-    if (bucket_ptr->hash == hash) {
-        tt_move = bucket_ptr->best_move;
+    if (root_bucket.hash == hash) {
+        tt_move = root_bucket.best_move;
     }
     for (i32 i = 0; i < legal_moves.count; i++) {
         Move mv = move_list_get(&legal_moves, i);
@@ -89,41 +425,98 @@ void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
         scored_moves.count++;
     }
     (*best_move) = peek_max(&scored_moves);
+    SearchArguments root_args;
+    root_args.board = board;
+    root_args.stop = stop_thinking;
+    root_args.thread = thread;
+    root_args.allow_null_move = true;
+    root_args.excluded_move = 0;
+    root_args.extensions = 0;
+    Centipawns previous_score = 0;
     while (1) {
         if (*stop_thinking)
             return;
-        Centipawns best_score_found = MIN_EVAL;
+        if (helper_skips_depth(thread, ply_depth + 1)) {
+            if (ply_depth >= depth_limit) {
+                return;
+            }
+            ply_depth++;
+            continue;
+        }
+        // Aspiration window around the previous iteration's score, widened
+        // on failure until the score falls inside it.
+        Centipawns delta = ASPIRATION_WINDOW;
         Centipawns alpha = MIN_EVAL;
         Centipawns beta = -MIN_EVAL;
-        ScoredMoveList scored_moves_copy = scored_moves;
-        Move best_move_found = peek_max(&scored_moves_copy);
-        for (int i = 0; i < legal_moves.count; i++) {
+        if (ply_depth >= ASPIRATION_MIN_DEPTH &&
+            abs(MIN_EVAL) - abs(previous_score) >= 1024) {
+            alpha = max_cp(previous_score - delta, MIN_EVAL);
+            beta = min_cp(previous_score + delta, -MIN_EVAL);
+        }
+        Centipawns best_score_found;
+        Move best_move_found;
+        while (1) {
+            const Centipawns window_alpha = alpha;
+            best_score_found = MIN_EVAL;
+            ScoredMoveList scored_moves_copy = scored_moves;
+            best_move_found = peek_max(&scored_moves_copy);
+            for (int i = 0; i < legal_moves.count; i++) {
+                if (*stop_thinking)
+                    return;
+                Move mv = pop_max(&scored_moves_copy);
+                board_make_move(board, mv);
+                Centipawns score;
+                if (i == 0) {
+                    score = search_child(&root_args, alpha, beta, ply_depth);
+                } else {
+                    score = search_child(&root_args, alpha, alpha + 1,
+                                         ply_depth);
+                    if (score > alpha && score < beta) {
+                        score = search_child(&root_args, alpha, beta,
+                                             ply_depth);
+                    }
+                }
+                board_unmake(board);
+                if (score > best_score_found) {
+                    best_score_found = score;
+                    best_move_found = mv;
+                }
+                for (int k = 0; k < legal_moves.count; k++) {
+                    if (scored_moves.items[k].mv == mv) {
+                        scored_moves.items[k].score = score;
+                        break;
+                    }
+                }
+                if (score > alpha) {
+                    alpha = score;
+                }
+                if (score >= beta) {
+                    break;
+                }
+            }
             if (*stop_thinking)
                 return;
-            Move mv = pop_max(&scored_moves_copy);
-            board_make_move(board, mv);
-            SearchArguments sub_args;
-            sub_args.board = board;
-            sub_args.alpha = -beta;
-            sub_args.beta = -alpha;
-            sub_args.ply_depth = ply_depth;
-            sub_args.stop = stop_thinking;
-            sub_args.nodes_searched = &nodes_searched;
-            Centipawns score = -search_recursive(sub_args);
-            if (score > best_score_found) {
-                best_score_found = score;
-                best_move_found = mv;
+            delta *= 2;
+            if (best_score_found <= window_alpha && window_alpha > MIN_EVAL) {
+                alpha = max_cp(best_score_found - delta, MIN_EVAL);
+                continue;
             }
-            board_unmake(board);
-            for (int k = 0; k < legal_moves.count; k++) {
-                if (scored_moves.items[k].mv == mv) {
-                    scored_moves.items[k].score = score;
-                    break;
-                }
+            if (best_score_found >= beta && beta < -MIN_EVAL) {
+                alpha = window_alpha;
+                beta = min_cp(best_score_found + delta, -MIN_EVAL);
+                continue;
+            }
+            break;
+        }
+        previous_score = best_score_found;
+        // Moves that failed low only have an upper bound, so make sure the
+        // best move is tried first next iteration.
+        for (int k = 0; k < legal_moves.count; k++) {
+            if (scored_moves.items[k].mv == best_move_found) {
+                scored_moves.items[k].score = -MIN_EVAL;
+                break;
             }
         }
-        if (*stop_thinking)
-            return;
         (*best_move) = best_move_found;
         char score_string[64];
         bool mate = false;
@@ -151,9 +544,10 @@ void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
         if (execution_time_ms == 0) {
             execution_time_ms = 1;
         }
+        const u64 nodes_searched = search_nodes_total();
         double npms = (double) nodes_searched / (double) execution_time_ms;
         double nps = npms * 1000.;
-        double hashfull = 1000. * (double) tt.filled / (double) tt.count;
+        const i32 hashfull = ttable_hashfull();
         char pv[8192];
         pv[0] = '\0';
         {
@@ -176,15 +570,15 @@ void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
                 board_make_move(board, mv);
                 sprintf(pv + strlen(pv), " %s", buf);
                 i++;
-                TTableBucket *bucket =
-                        ttable_probe(board_metadata_peek(board, 0)->_hash);
-                if (bucket->hash == 0) {
+                const u64 pv_hash = board_metadata_peek(board, 0)->_hash;
+                TTableBucket bucket = ttable_load(pv_hash);
+                if (bucket.hash != pv_hash) {
                     break;
                 }
-                if (bucket->node_type != kPV) {
+                if (bucket.node_type != kPV) {
                     break;
                 }
-                mv = bucket->best_move;
+                mv = bucket.best_move;
             }
             for (int k = 0; k < i; k++) {
                 board_unmake(board);
@@ -194,7 +588,7 @@ void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
             fprintf(outfile,
                     "info depth %i score %s nodes %llu nps %i hashfull %i time %i pv%s\n",
                     ply_depth + 1, score_string, (unsigned long long) nodes_searched,
-                    (int) nps, (int) hashfull, (int) execution_time_ms, pv);
+                    (int) nps, hashfull, (int) execution_time_ms, pv);
         }
         if (mate || ply_depth > 2048 || ply_depth >= depth_limit) {
             // there's a bug here, sometimes it doesn't return
@@ -207,24 +601,129 @@ void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
     }
 }
 
+#if defined(_WIN32) || defined(WIN32)
+DWORD WINAPI
+#else
+void *
+#endif
+search_helper(void *arg) {
+    SearchThread *thread = arg;
+    Move best_move = 0;
+    search_iterative(thread, &best_move, thread->stop, NULL,
+                     thread->depth_limit);
+    return 0;
+}
+
+/**
+ * Root search
+ * Lazy SMP: helper threads search copies of the board and share their
+ * results through tt, while the main thread searches and reports as usual.
+ * Helpers are stopped once the main thread is done.
+ * Returns the number of nodes searched by all threads.
+ */
+u64 search(Board *board, Move *best_move, AtomicBool *stop_thinking,
+           FILE *outfile, int depth_limit) {
+    AtomicBool helpers_stop = false;
+    ttable_new_search();
+    board_hash_prefetch = tt_prefetch_enabled ? ttable_prefetch : NULL;
+    THREAD *helpers = malloc(sizeof(THREAD) * search_thread_count);
+    SearchThread *main_thread = &search_threads[0];
+    main_thread->board = board;
+    main_thread->nodes = 0;
+    for (i32 t = 1; t < search_thread_count; t++) {
+        SearchThread *thread = &search_threads[t];
+        memcpy(thread->board, board, sizeof(Board));
+        thread->nodes = 0;
+        thread->stop = &helpers_stop;
+        thread->depth_limit = depth_limit;
+    }
+    for (i32 t = 1; t < search_thread_count; t++) {
+        THREAD_CREATE(&helpers[t], NULL, search_helper,
+                      (void *) &search_threads[t]);
+    }
+    search_iterative(main_thread, best_move, stop_thinking, outfile,
+                     depth_limit);
+    helpers_stop = true;
+    for (i32 t = 1; t < search_thread_count; t++) {
+        THREAD_JOIN(helpers[t], NULL);
+    }
+    free(helpers);
+    board_hash_prefetch = NULL;
+    return search_nodes_total();
+}
+
 /**
- * Quiescience search
+ * Quiescience search. Captures only, except in check, where every evasion is
+ * searched and there is no stand pat: the static eval of a position in check
+ * means nothing. Shares the transposition table with the main search, at
+ * depth 0.
  */
-Centipawns qsearch(Board *board, Centipawns alpha, Centipawns beta,
-                   AtomicBool *stop) {
-    int stand_pat = evaluation(board);
-    if (stand_pat >= beta) {
-        return beta;
+Centipawns qsearch(SearchThread *thread, Board *board, Centipawns alpha,
+                   Centipawns beta, AtomicBool *stop) {
+    thread->nodes++;
+    const u64 hash = board_metadata_peek(board, 0)->_hash;
+    Move tt_move = 0;
+    TTableBucket bucket = ttable_load(hash);
+    if (bucket.hash == hash) {
+        tt_move = bucket.best_move;
+        switch (bucket.node_type) {
+            case kCut:
+                alpha = max_cp(alpha, bucket.score);
+                break;
+            case kAll:
+                beta = min_cp(beta, bucket.score);
+                break;
+            case kPV:
+                return bucket.score;
+        }
+        if (alpha >= beta) {
+            return beta;
+        }
     }
-    if (alpha < stand_pat) {
-        alpha = stand_pat;
+    const bool in_check = board_is_check(board);
+    MoveList moves;
+    Centipawns stand_pat = MIN_EVAL;
+    if (in_check) {
+        // Evasion chains can cycle; captures alone can't.
+        if (board_metadata_peek(board, 0)->_is_repetition) {
+            return 0;
+        }
+        moves = generate_evasion_moves(board);
+        if (moves.count == 0) {
+            return mated_score(board);
+        }
+    } else {
+        stand_pat = evaluation(board);
+        if (stand_pat >= beta) {
+            return beta;
+        }
+        // Delta pruning: not even winning a queen (while promoting, if a
+        // pawn is about to) gets us back to alpha.
+        const u64 seventh_rank =
+                board->_turn == kWhite ? 0x00FF000000000000 : 0x000000000000FF00;
+        Centipawns max_gain = ORDERING_PIECE_VALUES[kQueen];
+        if (board->_bitboard[board->_turn] & board->_bitboard[kPawn] &
+            seventh_rank) {
+            max_gain += ORDERING_PIECE_VALUES[kQueen] -
+                        ORDERING_PIECE_VALUES[kPawn];
+        }
+        if (stand_pat + max_gain + QSEARCH_DELTA_MARGIN < alpha) {
+            return alpha;
+        }
+        if (alpha < stand_pat) {
+            alpha = stand_pat;
+        }
+        moves = generate_capture_moves(board);
     }
-    MoveList capture_moves = generate_capture_moves(board);
-    ScoredMoveList scored_capture_moves;
-    scored_capture_moves.count = 0;
-    for (int i = 0; i < capture_moves.count; i++) {
+    bucket.hash = hash;
+    bucket.depth = 0;
+    bucket.best_move = 0;
+    bucket.node_type = kAll;
+    ScoredMoveList scored_moves;
+    scored_moves.count = 0;
+    for (int i = 0; i < moves.count; i++) {
         // score based on MVV-LVA
-        Move mv = move_list_get(&capture_moves, i);
+        Move mv = move_list_get(&moves, i);
         u64 mv_src = move_get_src(mv);
         u64 mv_dest = move_get_dest(mv);
         i32 attacker = 0;
@@ -240,45 +739,289 @@ Centipawns qsearch(Board *board, Centipawns alpha, Centipawns beta,
         if (move_get_metadata(mv) == kEnPassantMove) {
             victim = kPawn;
         }
-        const i32 score = (victim * 10) + (10 - attacker);
-        scored_capture_moves.items[scored_capture_moves.count].mv = mv;
-        scored_capture_moves.items[scored_capture_moves.count].score = score;
-        scored_capture_moves.items[scored_capture_moves.count].valid = true;
-        scored_capture_moves.count++;
+        if (!in_check) {
+            // Delta pruning per capture: the victim, and the promotion if
+            // there is one, plus a margin for positional swings still
+            // doesn't reach alpha.
+            const u32 md = move_get_metadata(mv);
+            Centipawns gain = ORDERING_PIECE_VALUES[victim];
+            if (md & PROMOTION_BIT_FLAG) {
+                static const i32 promotions[4] = {kKnight, kBishop, kRook,
+                                                  kQueen};
+                gain += ORDERING_PIECE_VALUES[promotions[md & 0x3]] -
+                        ORDERING_PIECE_VALUES[kPawn];
+            }
+            if (stand_pat + gain + QSEARCH_DELTA_MARGIN <= alpha) {
+                continue;
+            }
+            // Captures that lose material by SEE can't raise alpha above the
+            // stand pat, so they aren't searched at all.
+            if (static_exchange_evaluation(board, mv) < 0) {
+                continue;
+            }
+        }
+        i32 score = victim ? (victim * 10) + (10 - attacker) : 0;
+        if (mv == tt_move) {
+            score = 1000;
+        }
+        scored_move_list_push(&scored_moves, mv, score);
     }
-    for (int i = 0; i < capture_moves.count; i++) {
+    for (int i = 0; i < scored_moves.count; i++) {
         if (*stop) {
             return alpha;
         }
-        Move mv = //move_list_get(&capture_moves, i);
-                pop_max(&scored_capture_moves);
+        Move mv = pop_max(&scored_moves);
         board_make_move(board, mv);
-        Centipawns score = -qsearch(board, -beta, -alpha, stop);
+        Centipawns score = -qsearch(thread, board, -beta, -alpha, stop);
         board_unmake(board);
         if (score >= beta) {
+            bucket.node_type = kCut;
+            bucket.best_move = mv;
+            bucket.score = beta;
+            ttable_store(&bucket);
             return beta;
         }
         if (score > alpha) {
+            bucket.node_type = kPV;
+            bucket.best_move = mv;
             alpha = score;
         }
     }
+    bucket.score = alpha;
+    ttable_store(&bucket);
     return alpha;
 }
 
 /**
- * Our workhorse Alpha-Beta Search
- * TODO: PVS
+ * Forward pruning margins, in centipawns per ply of remaining depth. Exposed
+ * as UCI options so they can be tuned against bench.
+ */
+static i32 reverse_futility_margin = 80;
+static i32 futility_margin = 120;
+static i32 razor_margin = 300;
+static i32 late_move_pruning_base = 3;
+
+static const SearchParameter SEARCH_PARAMETERS[] = {
+        {"RFP Margin", &reverse_futility_margin, 80, 0, 2000},
+        {"Futility Margin", &futility_margin, 120, 0, 2000},
+        {"Razor Margin", &razor_margin, 300, 0, 2000},
+        {"LMP Base", &late_move_pruning_base, 3, 0, 256},
+};
+
+i32 search_parameter_count(void) {
+    return (i32) (sizeof(SEARCH_PARAMETERS) / sizeof(SEARCH_PARAMETERS[0]));
+}
+
+const SearchParameter *search_parameter(i32 i) {
+    return &SEARCH_PARAMETERS[i];
+}
+
+/**
+ * Returns false if there is no parameter called name or value is out of range.
+ */
+bool search_set_parameter(const char *name, i32 value) {
+    for (i32 i = 0; i < search_parameter_count(); i++) {
+        const SearchParameter *param = &SEARCH_PARAMETERS[i];
+        if (strcmp(param->name, name) == 0) {
+            if (value < param->min || value > param->max) {
+                return false;
+            }
+            *param->value = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Late move reductions, indexed by [ply_depth][moves searched], filled in by
+ * init_tables.
+ */
+static i32 lmr_reductions[LMR_TABLE_SIZE][LMR_TABLE_SIZE];
+
+static void init_lmr_reductions(void) {
+    for (i32 depth = 1; depth < LMR_TABLE_SIZE; depth++) {
+        for (i32 moves = 1; moves < LMR_TABLE_SIZE; moves++) {
+            lmr_reductions[depth][moves] =
+                    (i32) (0.75 + log(depth) * log(moves) / 2.25);
+        }
+    }
+}
+
+/**
+ * How many plies to take off a late move, before it is made. Tactical moves,
+ * killers and moves out of check are searched at full depth; moves that give
+ * check are exempted by the caller.
+ */
+static i32 late_move_reduction(const SearchArguments *args, Move mv,
+                               i32 moves_searched, bool in_check) {
+    if (args->ply_depth < LMR_MIN_DEPTH || moves_searched < LMR_MIN_MOVES ||
+        in_check) {
+        return 0;
+    }
+    if (move_get_metadata(mv) & (CAPTURE_BIT_FLAG | PROMOTION_BIT_FLAG)) {
+        return 0;
+    }
+    if (is_killer_move(args->thread, args->board, mv)) {
+        return 0;
+    }
+    const i32 depth_idx = args->ply_depth < LMR_TABLE_SIZE
+                                  ? args->ply_depth : LMR_TABLE_SIZE - 1;
+    const i32 moves_idx = moves_searched < LMR_TABLE_SIZE
+                                  ? moves_searched : LMR_TABLE_SIZE - 1;
+    i32 reduction = lmr_reductions[depth_idx][moves_idx];
+    if (args->beta - args->alpha > 1) {
+        reduction--; // be less aggressive along the principal variation
+    }
+    // Always leave at least one ply before qsearch.
+    if (reduction > args->ply_depth - 2) {
+        reduction = args->ply_depth - 2;
+    }
+    return reduction > 0 ? reduction : 0;
+}
+
+/**
+ * Null move pruning: if passing still fails high against a reduced depth
+ * search, a real move almost certainly would too.
+ * Skipped where passing is not a safe lower bound: in check, in PV nodes, near
+ * mate scores, and with only pawns left, where zugzwang is common. With a
+ * single piece left zugzwang is still possible, so a fail high there is
+ * confirmed by a reduced search of the node itself with null moves disabled.
+ */
+static bool null_move_prune(const SearchArguments *args, bool in_check,
+                            Centipawns static_eval) {
+    Board *board = args->board;
+    if (!args->allow_null_move || args->ply_depth < NULL_MOVE_MIN_DEPTH ||
+        args->beta - args->alpha > 1 ||
+        abs(MIN_EVAL) - abs(args->beta) < 1024) {
+        return false;
+    }
+    const u64 pieces = board->_bitboard[board->_turn] &
+                       ~(board->_bitboard[kPawn] | board->_bitboard[kKing]);
+    if (!pieces || in_check || static_eval < args->beta) {
+        return false;
+    }
+    const i32 reduction = NULL_MOVE_REDUCTION + args->ply_depth / 4;
+    const i32 child_depth = args->ply_depth - 1 - reduction;
+    board_make_null_move(board);
+    SearchArguments sub_args = *args;
+    sub_args.alpha = -args->beta;
+    sub_args.beta = -args->beta + 1;
+    sub_args.ply_depth = child_depth > 0 ? child_depth : 0;
+    sub_args.allow_null_move = false;
+    const Centipawns score = -search_recursive(sub_args);
+    board_unmake_null_move(board);
+    if (*args->stop || score < args->beta) {
+        return false;
+    }
+    if (pop_count(pieces) > 1) {
+        return true;
+    }
+    SearchArguments verify_args = *args;
+    verify_args.alpha = args->beta - 1;
+    verify_args.ply_depth = args->ply_depth - reduction;
+    verify_args.allow_null_move = false;
+    return search_recursive(verify_args) >= args->beta;
+}
+
+/**
+ * Extensions are capped so that they make up at most half of the plies from
+ * the root, which keeps checks and singular moves from extending forever.
+ */
+static bool extension_allowed(const SearchArguments *args) {
+    return 2 * (args->extensions + 1) <=
+           search_ply(args->thread, args->board);
+}
+
+/**
+ * Singular extension test for the TT move: if the TT says it fails high, and
+ * a reduced search of every other move, with the bound lowered by a margin,
+ * fails low, the TT move is the only good one and is worth a deeper look.
+ */
+static bool is_singular_move(const SearchArguments *args,
+                             const TTableBucket *tt_entry) {
+    if (args->ply_depth < SINGULAR_MIN_DEPTH || args->excluded_move ||
+        tt_entry->hash == 0 ||
+        (tt_entry->node_type != kCut && tt_entry->node_type != kPV) ||
+        tt_entry->depth + SINGULAR_TT_DEPTH_SLACK < args->ply_depth ||
+        abs(MIN_EVAL) - abs(tt_entry->score) < 1024) {
+        return false;
+    }
+    const Centipawns singular_beta =
+            tt_entry->score - SINGULAR_MARGIN * args->ply_depth;
+    SearchArguments exclusion_args = *args;
+    exclusion_args.alpha = singular_beta - 1;
+    exclusion_args.beta = singular_beta;
+    exclusion_args.ply_depth = (args->ply_depth - 1) / 2;
+    exclusion_args.excluded_move = tt_entry->best_move;
+    return search_recursive(exclusion_args) < singular_beta;
+}
+
+/**
+ * History gravity: moves the entry towards +-HISTORY_MAX by bonus, by less
+ * the closer it already is, so scores stay bounded and old cutoffs fade.
+ */
+static void history_update(i16 *entry, i32 bonus) {
+    *entry = (i16) (*entry + bonus - *entry * abs(bonus) / HISTORY_MAX);
+}
+
+/**
+ * Called when quiet move best caused a cutoff: it becomes a killer and the
+ * countermove of the previous move, and gains history; the quiets searched
+ * before it without a cutoff lose history.
+ */
+static void update_quiet_ordering(SearchThread *thread, Board *board,
+                                  Move best, const Move *quiets,
+                                  i32 quiet_count, i32 ply_depth) {
+    OrderingTables *ordering = thread->ordering;
+    const i32 ply = search_ply(thread, board);
+    if (ply < MAX_SEARCH_PLY && ordering->killers[ply][0] != best) {
+        for (i32 i = KILLER_SLOTS - 1; i > 0; i--) {
+            ordering->killers[ply][i] = ordering->killers[ply][i - 1];
+        }
+        ordering->killers[ply][0] = best;
+    }
+    const PreviousMove prev = previous_move(board);
+    if (prev.piece) {
+        ordering->countermoves[board->_turn][prev.piece][prev.to] = best;
+    }
+    const i32 bonus = ply_depth * ply_depth < HISTORY_MAX / 8
+                              ? ply_depth * ply_depth : HISTORY_MAX / 8;
+    for (i32 i = -1; i < quiet_count; i++) {
+        const Move mv = i < 0 ? best : quiets[i];
+        const i32 move_bonus = i < 0 ? bonus : -bonus;
+        const u32 to = move_get_dest_u32(mv);
+        history_update(&ordering->history[board->_turn][move_get_src_u32(mv)][to],
+                       move_bonus);
+        if (prev.piece) {
+            const i32 piece = piece_on_square(board, move_get_src(mv));
+            history_update(&ordering->continuation[board->_turn][prev.piece]
+                                                  [prev.to][piece][to],
+                           move_bonus);
+        }
+    }
+}
+
+/**
+ * Our workhorse Alpha-Beta Search, with principal variation search
  */
 Centipawns search_recursive(SearchArguments args) {
-    (*args.nodes_searched)++;
+    if (args.ply_depth > 0) {
+        args.thread->nodes++; // horizon nodes are counted by qsearch
+    }
+    if (search_node_limit && args.thread->id == 0 &&
+        args.thread->nodes >= search_node_limit) {
+        *args.stop = true;
+    }
     Move tt_move = 0;
     u64 hash = board_metadata_peek(args.board, 0)->_hash;
-    TTableBucket *bucket_ptr = ttable_probe(hash);
-    TTableBucket bucket_prev = *bucket_ptr;
-    TTableBucket bucket = *bucket_ptr;
+    TTableBucket bucket = ttable_load(hash);
+    const TTableBucket tt_entry = bucket;
     if (bucket.hash == hash) {
         tt_move = bucket.best_move;
-        if (bucket.depth >= args.ply_depth) {
+        // The exclusion search must not be cut off by the entry it is
+        // trying to second-guess.
+        if (bucket.depth >= args.ply_depth && !args.excluded_move) {
             switch (bucket.node_type) {
                 case kCut:
                     args.alpha = max_cp(args.alpha, bucket.score);
@@ -297,78 +1040,123 @@ Centipawns search_recursive(SearchArguments args) {
             //return bucket.score;
         }
     }
-    i32 status = board_status(args.board);
-    if (status == kCheckmate) {
-        Centipawns mating_score = MIN_EVAL + (i32) args.board->_ply;
-        return mating_score;
-    }
-    if (status == kStalemate || status == kDraw) {
+    BoardMetadata *md = board_metadata_peek(args.board, 0);
+    if (md->_is_repetition || (md->_halfmove_counter >= 100)) {
         return 0; // TODO: contempt factor
     }
     if (args.ply_depth == 0) {
-        return qsearch(args.board, args.alpha, args.beta, args.stop);
+        // Mate and stalemate are otherwise detected after the move loop, but
+        // qsearch only looks at captures.
+        if (!board_has_legal_move(args.board)) {
+            return board_is_check(args.board) ? mated_score(args.board) : 0;
+        }
+        return qsearch(args.thread, args.board, args.alpha, args.beta,
+                       args.stop);
+    }
+    const bool in_check = board_is_check(args.board);
+    const bool pv_node = args.beta - args.alpha > 1;
+    const Centipawns static_eval = in_check ? MIN_EVAL : evaluation(args.board);
+    if (!in_check && !pv_node && !args.excluded_move) {
+        // Reverse futility: the static eval is so far above beta that no
+        // quiet continuation is likely to bring it back down.
+        if (args.ply_depth <= RFP_MAX_DEPTH &&
+            abs(MIN_EVAL) - abs(args.beta) >= 1024 &&
+            static_eval - reverse_futility_margin * args.ply_depth >=
+                    args.beta) {
+            return args.beta;
+        }
+        // Razoring: so far below alpha that only a capture can save us; if
+        // qsearch agrees, trust it.
+        if (args.ply_depth <= RAZOR_MAX_DEPTH &&
+            static_eval + razor_margin * args.ply_depth < args.alpha) {
+            const Centipawns score = qsearch(args.thread, args.board,
+                                             args.alpha, args.alpha + 1,
+                                             args.stop);
+            if (score <= args.alpha) {
+                return args.alpha;
+            }
+        }
+    }
+    if (!args.excluded_move && null_move_prune(&args, in_check, static_eval)) {
+        return args.beta;
     }
     // WHY DO WE START INSERTING AFTER HERE???
     // do we want to store leaf results??
-    if (bucket.hash == 0) {
-        tt.filled += 1;
-    }
     bucket.hash = hash;
     bucket.depth = (u8) args.ply_depth;
-    MoveList legal_moves = generate_all_legal_moves(args.board);
-    ScoredMoveList scored_moves;
-    scored_moves.count = 0;
-    for (i32 i = 0; i < legal_moves.count; i++) {
-        Move mv = move_list_get(&legal_moves, i);
-        u64 src = move_get_src(mv);
-        i32 score = 0;
-        u64 masked_killer = ((u64) mv) & killer_table.mask;
-        KillerTableBucket *killer_bucket = &killer_table.buckets[masked_killer];
-        if (src & CAPTURE_BIT_FLAG) {
-            u64 dest = move_get_dest(mv);
-            i32 attacker = 0;
-            i32 victim = 0;
-            for (i32 p = kPawn; p <= kKing; p++) {
-                if (src & args.board->_bitboard[p] & args.board->_bitboard[args.board->_turn]) {
-                    attacker = p;
-                }
-                if (dest & args.board->_bitboard[p] & args.board->_bitboard[!args.board->_turn]) {
-                    victim = p;
-                }
-            }
-            if (move_get_metadata(mv) == kEnPassantMove) {
-                victim = kPawn;
-            }
-            score = (victim * 10) + (10 - attacker);
-        }
-        if (killer_bucket->root_distance == args.board->_ply && killer_bucket->mv == mv) {
-            score = 101;
-        }
-        if (mv == tt_move) {
-            score = 1000;
-        }
-        scored_moves.items[scored_moves.count].mv = mv;
-        scored_moves.items[scored_moves.count].score = score;
-        scored_moves.items[scored_moves.count].valid = true;
-        scored_moves.count++;
-    }
-    bucket.best_move = peek_max(&scored_moves);
+    bucket.best_move = 0;
     bucket.node_type = kAll; // Default is all-node, an upper bound (exact score might be lower)
-    for (int i = 0; i < legal_moves.count; i++) {
+    MovePicker picker;
+    move_picker_init(&picker, args.board, args.thread, tt_move);
+    Move mv;
+    i32 moves_searched = 0;
+    Move quiets_searched[64];
+    i32 quiet_count = 0;
+    // Quiet moves that can't raise the static eval to alpha are skipped near
+    // the horizon (futility pruning), as are the late ones (move count based
+    // late move pruning). Never before one move has been searched, so a node
+    // with legal moves is never mistaken for mate.
+    const bool futile = !in_check && args.ply_depth <= FUTILITY_MAX_DEPTH &&
+                        abs(MIN_EVAL) - abs(args.alpha) >= 1024 &&
+                        static_eval + futility_margin * args.ply_depth <=
+                                args.alpha;
+    const i32 late_move_count =
+            !in_check && args.ply_depth <= LMP_MAX_DEPTH
+                    ? late_move_pruning_base + args.ply_depth * args.ply_depth
+                    : MOVELIST_STACK_COUNT;
+    while ((mv = move_picker_next(&picker)) != 0) {
         if (*args.stop) {
             return args.alpha;
         }
-        Move mv = pop_max(&scored_moves);
+        if (mv == args.excluded_move) {
+            continue;
+        }
+        if (bucket.best_move == 0) {
+            bucket.best_move = mv;
+        }
+        // Pruned moves are never made, so check is detected from the board.
+        const bool gives_check = board_move_gives_check(args.board, mv);
+        if (moves_searched > 0 && !gives_check &&
+            !(move_get_metadata(mv) & (CAPTURE_BIT_FLAG | PROMOTION_BIT_FLAG)) &&
+            (futile || moves_searched >= late_move_count)) {
+            continue;
+        }
+        const i32 reduction =
+                gives_check ? 0
+                            : late_move_reduction(&args, mv, moves_searched,
+                                                  in_check);
+        const bool may_extend = extension_allowed(&args);
+        const bool singular = may_extend && mv == tt_move &&
+                              is_singular_move(&args, &tt_entry);
         board_make_move(args.board, mv);
-        SearchArguments sub_args;
-        sub_args.board = args.board;
-        sub_args.alpha = -args.beta;
-        sub_args.beta = -args.alpha;
-        sub_args.ply_depth = args.ply_depth - 1;
-        sub_args.stop = args.stop;
-        sub_args.nodes_searched = args.nodes_searched;
-        Centipawns score = -search_recursive(sub_args);
+        // At most one ply per move, and only while extensions make up no
+        // more than half of the path.
+        SearchArguments move_args = args;
+        const i32 extension = may_extend && (gives_check || singular) ? 1 : 0;
+        move_args.extensions += extension;
+        const i32 child_depth = args.ply_depth - 1 + extension;
+        // PVS: the first move gets the full window, the others only have to
+        // prove they can't beat alpha, and are re-searched if they do.
+        // Late quiet moves are first searched at reduced depth, and only get
+        // the full depth if that beats alpha.
+        Centipawns score;
+        if (moves_searched == 0) {
+            score = search_child(&move_args, args.alpha, args.beta,
+                                 child_depth);
+        } else {
+            score = search_child(&move_args, args.alpha, args.alpha + 1,
+                                 child_depth - reduction);
+            if (reduction > 0 && score > args.alpha) {
+                score = search_child(&move_args, args.alpha, args.alpha + 1,
+                                     child_depth);
+            }
+            if (score > args.alpha && score < args.beta) {
+                score = search_child(&move_args, args.alpha, args.beta,
+                                     child_depth);
+            }
+        }
         board_unmake(args.board);
+        moves_searched++;
         if (score >= args.beta) {
             // this is a Cut-node
             // we return a lower bound; the exact score might be higher
@@ -376,23 +1164,32 @@ Centipawns search_recursive(SearchArguments args) {
             bucket.best_move = mv;
             args.alpha = args.beta;
             if (!(move_get_metadata(mv) & CAPTURE_BIT_FLAG)) {
-                u64 masked_killer = ((u64) mv) & killer_table.mask;
-                killer_table.buckets[masked_killer].mv = mv;
-                killer_table.buckets[masked_killer].root_distance = args.board->_ply;
+                update_quiet_ordering(args.thread, args.board, mv,
+                                      quiets_searched, quiet_count,
+                                      args.ply_depth);
             }
             break;
         }
+        if (!(move_get_metadata(mv) & CAPTURE_BIT_FLAG) && quiet_count < 64) {
+            quiets_searched[quiet_count++] = mv;
+        }
         if (score > args.alpha) {
             bucket.node_type = kPV;
             bucket.best_move = mv;
             args.alpha = score;
         }
     }
-    bucket.score = args.alpha;
-    bool eviction_cond = (bucket_prev.node_type != kPV || bucket_prev.hash == 0) && (bucket_prev.depth <= bucket.depth);
-    if (eviction_cond) {
-        (*bucket_ptr) = bucket;
+    if (args.excluded_move) {
+        // Not this node's real score, so it isn't stored; and the excluded
+        // move being the only one doesn't make this mate.
+        return args.alpha;
+    }
+    if (bucket.best_move == 0) {
+        // No legal moves: checkmate or stalemate.
+        return board_is_check(args.board) ? mated_score(args.board) : 0;
     }
+    bucket.score = args.alpha;
+    ttable_store(&bucket);
     return args.alpha;
 }
 
@@ -431,45 +1228,454 @@ Move peek_max(ScoredMoveList *scored_moves) {
     return best.mv;
 }
 
-TTableBucket *ttable_probe(u64 hash) {
-    TTableBucket *bucket = &tt.buckets[hash & tt.mask];
+#define TT_GENERATION_MASK 0x3f
+
+static inline TTableCluster *ttable_cluster(u64 hash) {
+    return &tt.clusters[hash & tt.mask];
+}
+
+static inline i32 ttable_entry_depth(u32 info) {
+    return (i32) ((info >> 16) & 0xff);
+}
+
+static inline i32 ttable_entry_generation(u32 info) {
+    return (i32) ((info >> 24) & TT_GENERATION_MASK);
+}
+
+static inline i32 ttable_entry_node_type(u32 info) {
+    return (i32) (info >> 30);
+}
+
+/**
+ * Searches since the entry was last stored, modulo the generation counter.
+ */
+static inline i32 ttable_entry_age(u32 info) {
+    return (tt.generation - ttable_entry_generation(info)) & TT_GENERATION_MASK;
+}
+
+/**
+ * Hints the cluster for hash into cache; installed as board_hash_prefetch
+ * during search, so the DRAM miss of the child's probe overlaps with the rest
+ * of board_make_move.
+ */
+static void ttable_prefetch(u64 hash) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ttable_cluster(hash));
+#elif defined(_MSC_VER)
+    _mm_prefetch((const char *) ttable_cluster(hash), _MM_HINT_T0);
+#else
+    (void) hash;
+#endif
+}
+
+void search_set_tt_prefetch(bool enabled) {
+    tt_prefetch_enabled = enabled;
+}
+
+/**
+ * Stops every following search once the main thread has searched nodes
+ * nodes, so results don't depend on the machine. 0 removes the limit.
+ */
+void search_set_node_limit(u64 nodes) {
+    search_node_limit = nodes;
+}
+
+/**
+ * Looks hash up in its cluster. On a miss the returned bucket has hash 0.
+ */
+TTableBucket ttable_load(u64 hash) {
+    const TTableCluster *cluster = ttable_cluster(hash);
+    const u32 hash_key = (u32) (hash >> 32);
+    TTableBucket bucket;
+    bucket.hash = 0;
+    bucket.depth = 0;
+    bucket.node_type = 0;
+    bucket.best_move = 0;
+    bucket.score = 0;
+    for (i32 i = 0; i < TT_CLUSTER_SIZE; i++) {
+        const TTableEntry *entry = &cluster->entries[i];
+        const u32 key = entry->key;
+        const u32 info = entry->info;
+        const i32 score = entry->score;
+        if ((key ^ info ^ (u32) score) != hash_key ||
+            ttable_entry_node_type(info) == 0) {
+            continue;
+        }
+        bucket.hash = hash;
+        bucket.depth = (u8) ttable_entry_depth(info);
+        bucket.node_type = (u8) ttable_entry_node_type(info);
+        bucket.best_move = (Move) (info & 0xffff);
+        bucket.score = score;
+        break;
+    }
     return bucket;
 }
 
-// TODO: add parameters
-void init_tables(void) {
-    {
-        const u64 target_table_size_mib = 16; // 1mib = 1024 x 1024 bytes
-        const u64 target_table_size_b = target_table_size_mib * 1024 * 1024;
-        const u64 bucket_size_b = sizeof(TTableBucket);
-        int n = 0;
-        u64 count;
-        while (1) {
-            count = (u64) 1 << n;
-            const u64 table_size_b = count * bucket_size_b;
-            if (table_size_b > target_table_size_b) {
-                count = (u64) 1 << (n - 1);
-                break;
+/**
+ * An entry for the same position is overwritten unless it is deeper and from
+ * the current search, and the new one isn't exact. Otherwise the entry with
+ * the lowest depth, counting each search of age as 8 plies, is replaced.
+ */
+void ttable_store(const TTableBucket *bucket) {
+    TTableCluster *cluster = ttable_cluster(bucket->hash);
+    const u32 hash_key = (u32) (bucket->hash >> 32);
+    TTableEntry *replace = &cluster->entries[0];
+    i32 replace_worth = INT32_MAX;
+    for (i32 i = 0; i < TT_CLUSTER_SIZE; i++) {
+        TTableEntry *entry = &cluster->entries[i];
+        const u32 info = entry->info;
+        if (ttable_entry_node_type(info) == 0) {
+            replace = entry;
+            break;
+        }
+        if ((entry->key ^ info ^ (u32) entry->score) == hash_key) {
+            if (bucket->node_type != kPV && ttable_entry_age(info) == 0 &&
+                ttable_entry_depth(info) > bucket->depth) {
+                return;
             }
-            n++;
+            replace = entry;
+            break;
+        }
+        const i32 worth =
+                ttable_entry_depth(info) - 8 * ttable_entry_age(info);
+        if (worth < replace_worth) {
+            replace_worth = worth;
+            replace = entry;
+        }
+    }
+    const u32 info = (u32) bucket->best_move | ((u32) bucket->depth << 16) |
+                     ((u32) (tt.generation & TT_GENERATION_MASK) << 24) |
+                     ((u32) bucket->node_type << 30);
+    replace->key = hash_key ^ info ^ (u32) bucket->score;
+    replace->info = info;
+    replace->score = bucket->score;
+}
+
+/**
+ * Permille of the table used by the current search, estimated from the first
+ * 1000 entries.
+ */
+i32 ttable_hashfull(void) {
+    i32 used = 0;
+    i32 sampled = 0;
+    for (u64 c = 0; c < tt.count && sampled < 1000; c++) {
+        for (i32 i = 0; i < TT_CLUSTER_SIZE && sampled < 1000; i++) {
+            const u32 info = tt.clusters[c].entries[i].info;
+            if (ttable_entry_node_type(info) != 0 &&
+                ttable_entry_age(info) == 0) {
+                used++;
+            }
+            sampled++;
+        }
+    }
+    return sampled ? used * 1000 / sampled : 0;
+}
+
+/**
+ * Ages every entry by one search. Called at the start of each search and on
+ * ucinewgame.
+ */
+void ttable_new_search(void) {
+    tt.generation = (tt.generation + 1) & TT_GENERATION_MASK;
+}
+
+/**
+ * The table is allocated on 2 MiB boundaries and, on Linux, marked for
+ * transparent huge pages, which cuts TLB misses on large tables. Memory is
+ * not zeroed here; ttable_clear does that (and prefaults it) in parallel.
+ */
+static void *ttable_memory_alloc(u64 size_b) {
+#if defined(_WIN32) || defined(WIN32)
+    return VirtualAlloc(NULL, size_b, MEM_RESERVE | MEM_COMMIT,
+                        PAGE_READWRITE);
+#else
+    const u64 alignment = (u64) 2 * 1024 * 1024;
+    void *memory = NULL;
+    if (posix_memalign(&memory, alignment,
+                       (size_b + alignment - 1) & ~(alignment - 1)) != 0) {
+        return NULL;
+    }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    madvise(memory, size_b, MADV_HUGEPAGE);
+#endif
+    return memory;
+#endif
+}
+
+static void ttable_memory_free(void *memory) {
+#if defined(_WIN32) || defined(WIN32)
+    if (memory) {
+        VirtualFree(memory, 0, MEM_RELEASE);
+    }
+#else
+    free(memory);
+#endif
+}
+
+typedef struct TTableClearJob {
+    TTableCluster *clusters;
+    u64 count;
+} TTableClearJob;
+
+#if defined(_WIN32) || defined(WIN32)
+DWORD WINAPI
+#else
+void *
+#endif
+ttable_clear_worker(void *arg) {
+    TTableClearJob *job = arg;
+    memset(job->clusters, 0, job->count * sizeof(TTableCluster));
+    return 0;
+}
+
+/**
+ * Zeroes the table with one thread per hardware thread (or per search thread,
+ * if there are more), so even tables of tens of GiB are cleared quickly
+ * whatever Threads is set to.
+ */
+static void ttable_clear(void) {
+    const i32 hardware_threads = hardware_thread_count();
+    const i32 threads = search_thread_count > hardware_threads
+                        ? search_thread_count
+                        : hardware_threads;
+    THREAD *workers = malloc(sizeof(THREAD) * threads);
+    TTableClearJob *jobs = malloc(sizeof(TTableClearJob) * threads);
+    const u64 stride = (tt.count + threads - 1) / threads;
+    for (i32 t = 0; t < threads; t++) {
+        const u64 start = stride * t < tt.count ? stride * t : tt.count;
+        const u64 end = start + stride < tt.count ? start + stride : tt.count;
+        jobs[t].clusters = tt.clusters + start;
+        jobs[t].count = end - start;
+    }
+    for (i32 t = 1; t < threads; t++) {
+        THREAD_CREATE(&workers[t], NULL, ttable_clear_worker, (void *) &jobs[t]);
+    }
+    ttable_clear_worker(&jobs[0]);
+    for (i32 t = 1; t < threads; t++) {
+        THREAD_JOIN(workers[t], NULL);
+    }
+    free(workers);
+    free(jobs);
+    tt.generation = 0;
+}
+
+/**
+ * Replaces the table with an uncleared one of count clusters. The new table
+ * is allocated before the old one is freed, so on failure the old table is
+ * kept and false is returned.
+ */
+static bool ttable_resize(u64 count) {
+    TTableCluster *clusters = ttable_memory_alloc(count * sizeof(TTableCluster));
+    if (clusters == NULL) {
+        printf("info string failed to allocate %llu MiB for the hash table\n",
+               (unsigned long long) (count * sizeof(TTableCluster) >> 20));
+        return false;
+    }
+    ttable_memory_free(tt.clusters);
+    tt.clusters = clusters;
+    tt.count = count;
+    tt.mask = count - 1;
+    return true;
+}
+
+/**
+ * Resizes the transposition table to the largest power of two number of
+ * clusters that fits in size_mib MiB. Its contents are lost. If the memory
+ * can't be allocated the current table is kept and false is returned. Must
+ * not be called while a search is running.
+ */
+bool search_set_hash(u64 size_mib) {
+    if (size_mib < 1) {
+        size_mib = 1;
+    }
+    const u64 target_table_size_b = size_mib * 1024 * 1024;
+    u64 count = 1;
+    while (count * 2 * sizeof(TTableCluster) <= target_table_size_b) {
+        count *= 2;
+    }
+    if (!ttable_resize(count)) {
+        return false;
+    }
+    ttable_clear();
+    return true;
+}
+
+#define TT_FILE_MAGIC "BLOBTT\0"
+#define TT_FILE_VERSION 1
+
+/**
+ * Transposition table snapshot header. The clusters follow it verbatim, and
+ * it is one cache line long so they stay aligned if the file is mapped.
+ */
+typedef struct TTableFileHeader {
+    char magic[8];
+    u32 version;
+    u32 cluster_size;
+    u64 zobrist_signature;
+    u64 cluster_count;
+    u32 generation;
+    u8 padding[28];
+} TTableFileHeader;
+
+/**
+ * Writes the transposition table to filename. Must not be called while a
+ * search is running.
+ */
+bool ttable_save_file(const char *filename) {
+    FILE *fp = fopen(filename, "wb");
+    if (fp == NULL) {
+        printf("info string could not open %s for writing\n", filename);
+        return false;
+    }
+    TTableFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TT_FILE_MAGIC, sizeof(header.magic));
+    header.version = TT_FILE_VERSION;
+    header.cluster_size = sizeof(TTableCluster);
+    header.zobrist_signature = zobrist_keys_signature();
+    header.cluster_count = tt.count;
+    header.generation = tt.generation;
+    bool ok = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+              fwrite(tt.clusters, sizeof(TTableCluster), tt.count, fp) ==
+              tt.count;
+    ok = (fclose(fp) == 0) && ok;
+    if (!ok) {
+        printf("info string failed writing %s\n", filename);
+    }
+    return ok;
+}
+
+/**
+ * Returns the size of fp in bytes, leaving the file position where it was,
+ * or -1 if it can't be determined.
+ */
+static i64 ttable_file_size(FILE *fp) {
+#if defined(_WIN32) || defined(WIN32)
+    const i64 position = _ftelli64(fp);
+    if (position < 0 || _fseeki64(fp, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    const i64 size = _ftelli64(fp);
+    return _fseeki64(fp, position, SEEK_SET) == 0 ? size : -1;
+#else
+    const i64 position = ftello(fp);
+    if (position < 0 || fseeko(fp, 0, SEEK_END) != 0) {
+        return -1;
+    }
+    const i64 size = ftello(fp);
+    return fseeko(fp, position, SEEK_SET) == 0 ? size : -1;
+#endif
+}
+
+/**
+ * Replaces the transposition table with a snapshot written by
+ * ttable_save_file, resizing the table to the snapshot's size. Snapshots from
+ * a build with different Zobrist keys or entry layout are rejected. Must not
+ * be called while a search is running.
+ */
+bool ttable_load_file(const char *filename) {
+    FILE *fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        printf("info string could not open %s\n", filename);
+        return false;
+    }
+    TTableFileHeader header;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, TT_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != TT_FILE_VERSION ||
+        header.cluster_size != sizeof(TTableCluster) ||
+        header.zobrist_signature != zobrist_keys_signature() ||
+        header.cluster_count == 0 ||
+        (header.cluster_count & (header.cluster_count - 1)) != 0) {
+        printf("info string %s is not a compatible hash table file\n",
+               filename);
+        fclose(fp);
+        return false;
+    }
+    // Checked before resizing so a corrupt count can't overflow the size.
+    const u64 max_count = (u64) MAX_HASH_MIB * 1024 * 1024 /
+                          sizeof(TTableCluster);
+    if (header.cluster_count > max_count ||
+        ttable_file_size(fp) !=
+        (i64) (sizeof(header) + header.cluster_count * sizeof(TTableCluster))) {
+        printf("info string %s does not match its header\n", filename);
+        fclose(fp);
+        return false;
+    }
+    if (header.cluster_count != tt.count &&
+        !ttable_resize(header.cluster_count)) {
+        fclose(fp);
+        return false;
+    }
+    const bool ok = fread(tt.clusters, sizeof(TTableCluster), tt.count, fp) ==
+                    tt.count;
+    fclose(fp);
+    if (!ok) {
+        printf("info string %s is truncated\n", filename);
+        ttable_clear();
+        return false;
+    }
+    tt.generation = (u8) (header.generation & TT_GENERATION_MASK);
+    return true;
+}
+
+void init_tables(void) {
+    init_lmr_reductions();
+    if (!search_set_hash(16)) {
+        exit(1); // no table to fall back on
+    }
+    search_set_threads(1);
+}
+
+/**
+ * Resizes the thread pool used by search. Must not be called while a search
+ * is running.
+ */
+void search_set_threads(i32 count) {
+    if (count < 1) {
+        count = 1;
+    }
+    for (i32 t = 0; t < search_thread_count; t++) {
+        if (t > 0) {
+            free(search_threads[t].board);
         }
-        tt.count = count;
-        tt.filled = 0;
-        tt.buckets = calloc(1, count * bucket_size_b);
-        tt.mask = count - 1;
-//        printf("info transposition table size %i mib\n",
-//               (int) (count * bucket_size_b / (1024 * 1024)));
-//        printf("info transposition table count %llu buckets\n",
-//               (long long unsigned) tt.count);
+        free(search_threads[t].ordering);
     }
-    {
-        killer_table.count = (u64) 1 << 16;
-        killer_table.mask = killer_table.count - 1;
-        killer_table.buckets = calloc(1, sizeof(KillerTableBucket) * killer_table.count);
+    free(search_threads);
+    search_thread_count = count;
+    search_threads = calloc(count, sizeof(SearchThread));
+    for (i32 t = 0; t < count; t++) {
+        SearchThread *thread = &search_threads[t];
+        thread->id = t;
+        thread->board = t > 0 ? calloc(1, sizeof(Board)) : NULL;
+        thread->ordering = calloc(1, sizeof(OrderingTables));
+    }
+}
+
+i32 search_get_threads(void) {
+    return search_thread_count;
+}
+
+/**
+ * Forgets everything learned from previous searches.
+ */
+void clear_tables(void) {
+    ttable_clear();
+    for (i32 t = 0; t < search_thread_count; t++) {
+        memset(search_threads[t].ordering, 0, sizeof(OrderingTables));
     }
 }
 
 void destroy_tables(void) {
-    free(tt.buckets);
-    free(killer_table.buckets);
+    ttable_memory_free(tt.clusters);
+    tt.clusters = NULL;
+    for (i32 t = 0; t < search_thread_count; t++) {
+        if (t > 0) {
+            free(search_threads[t].board);
+        }
+        free(search_threads[t].ordering);
+    }
+    free(search_threads);
+    search_threads = NULL;
+    search_thread_count = 0;
 }
@@ -9,12 +9,54 @@ typedef int32_t Centipawns;
 
 static const Centipawns MIN_EVAL = -1000000;
 
+#define MAX_SEARCH_THREADS 256
+
+// Half-width of the first aspiration window, and the first iteration (as
+// ply_depth, i.e. depth - 1) that uses one.
+#define ASPIRATION_WINDOW 25
+#define ASPIRATION_MIN_DEPTH 3
+
+// Null move pruning is tried from this ply_depth on, reducing the null search
+// by NULL_MOVE_REDUCTION plus one ply for every four of depth.
+#define NULL_MOVE_MIN_DEPTH 2
+#define NULL_MOVE_REDUCTION 2
+
+// Late move reductions apply from this ply_depth on, to quiet moves after the
+// first LMR_MIN_MOVES. Depths and move counts past the table share its last
+// row and column.
+#define LMR_MIN_DEPTH 3
+#define LMR_MIN_MOVES 2
+#define LMR_TABLE_SIZE 64
+
+// Deepest ply_depth each forward pruning technique is applied at. Their
+// margins are search parameters.
+#define RFP_MAX_DEPTH 6
+#define RAZOR_MAX_DEPTH 2
+#define FUTILITY_MAX_DEPTH 3
+#define LMP_MAX_DEPTH 3
+
+// Slack given to a capture's material gain before qsearch prunes it as unable
+// to reach alpha.
+#define QSEARCH_DELTA_MARGIN 200
+
+// Singular extensions are tried from this ply_depth on, for TT moves stored
+// at most SINGULAR_TT_DEPTH_SLACK plies shallower than the node. The others
+// must fail low against the TT score minus SINGULAR_MARGIN per ply.
+#define SINGULAR_MIN_DEPTH 6
+#define SINGULAR_TT_DEPTH_SLACK 3
+#define SINGULAR_MARGIN 2
+
+#define MAX_HASH_MIB 131072
+
 enum NodeType {
     kPV = 1,
     kCut = 2,
     kAll = 3,
 };
 
+/**
+ * Unpacked view of a transposition table entry.
+ */
 typedef struct TTableBucket {
     u64 hash; // 0 if not present
     u8 depth;
@@ -23,11 +65,34 @@ typedef struct TTableBucket {
     Centipawns score;
 } TTableBucket;
 
+/**
+ * Compressed 12 byte entry. Only the upper 32 bits of the hash are kept, the
+ * lower bits select the cluster.
+ * Entries are shared between search threads without locking: the key is
+ * stored XORed with both data words, so an entry torn by concurrent stores no
+ * longer matches and is ignored.
+ */
+typedef struct TTableEntry {
+    u32 key;   // (hash >> 32) ^ info ^ score
+    u32 info;  // best_move | depth << 16 | generation << 24 | node_type << 30
+    i32 score;
+} TTableEntry;
+
+#define TT_CLUSTER_SIZE 5
+
+/**
+ * One cache line worth of entries, so a probe touches a single line.
+ */
+typedef struct TTableCluster {
+    TTableEntry entries[TT_CLUSTER_SIZE];
+    u32 padding;
+} TTableCluster;
+
 typedef struct TranspositionTable {
-    TTableBucket *buckets;
-    u64 count;
+    TTableCluster *clusters;
+    u64 count; // clusters
     u64 mask;
-    u64 filled;
+    u8 generation;
 } TranspositionTable;
 
 /*
@@ -44,16 +109,32 @@ typedef struct PVTable {
 } PVTable;
 */
 
-typedef struct KillerTableBucket {
-    Move mv;
-    u32 root_distance;
-} KillerTableBucket;
-
-typedef struct KillerTable {
-    KillerTableBucket *buckets;
-    u64 count;
-    u64 mask;
-} KillerTable;
+// Plies from the root that killers are kept for; deeper nodes go without.
+#define MAX_SEARCH_PLY 128
+
+#define KILLER_SLOTS 2
+
+// History scores saturate towards +-HISTORY_MAX under the gravity update.
+#define HISTORY_MAX 16384
+
+/**
+ * Quiet move ordering state, one per search thread.
+ * killers: the last two quiet moves that caused a cutoff at each ply from
+ * the root, newest first.
+ * history: butterfly table of cutoffs, by [side to move][from][to].
+ * countermoves: the quiet move that last refuted the previous move, by
+ * [side to move][piece][to] of that previous move.
+ * continuation: history of a quiet move [piece][to] in reply to the previous
+ * move [piece][to], also split by side to move.
+ * Both are split by side like history, since the piece types alone don't say
+ * whose piece it is.
+ */
+typedef struct OrderingTables {
+    Move killers[MAX_SEARCH_PLY][KILLER_SLOTS];
+    i16 history[2][64][64];
+    Move countermoves[2][8][64];
+    i16 continuation[2][8][64][8][64];
+} OrderingTables;
 
 /* Evaluation */
 
@@ -61,9 +142,50 @@ Centipawns evaluation(Board *board);
 
 /* Search */
 
-void search(Board *board, Move *best_move, AtomicBool *stop_thinking,
-            FILE *outfile, int depth_limit);
+u64 search(Board *board, Move *best_move, AtomicBool *stop_thinking,
+           FILE *outfile, int depth_limit);
 
 void init_tables(void);
 
+TTableBucket ttable_load(u64 hash);
+
+void ttable_store(const TTableBucket *bucket);
+
+i32 ttable_hashfull(void);
+
+void ttable_new_search(void);
+
+bool ttable_save_file(const char *filename);
+
+bool ttable_load_file(const char *filename);
+
+bool search_set_hash(u64 size_mib);
+
+void search_set_tt_prefetch(bool enabled);
+
+void search_set_node_limit(u64 nodes);
+
+void search_set_threads(i32 count);
+
+/**
+ * An integer search parameter, settable as a UCI spin option.
+ */
+typedef struct SearchParameter {
+    const char *name;
+    i32 *value;
+    i32 default_value;
+    i32 min;
+    i32 max;
+} SearchParameter;
+
+i32 search_parameter_count(void);
+
+const SearchParameter *search_parameter(i32 i);
+
+bool search_set_parameter(const char *name, i32 value);
+
+i32 search_get_threads(void);
+
+void clear_tables(void);
+
 void destroy_tables(void);
@@ -10,12 +10,46 @@ typedef struct PerftResults {
   u64 promotions;
 } PerftResults;
 
+/**
+ * Hash table of subtree node counts for perft, keyed by Zobrist hash and
+ * depth. Entries are always replaced.
+ * The table is shared between perft threads without locking: key is stored
+ * XORed with data, so an entry torn by a concurrent write fails to verify.
+ */
+typedef struct PerftTableEntry {
+  u64 key;  // hash ^ data
+  u64 data; // nodes << 8 | depth
+} PerftTableEntry;
+
+typedef struct PerftTable {
+  PerftTableEntry *entries;
+  u64 count;
+  u64 mask;
+} PerftTable;
+
 PerftResults perft(Board *board, int depth);
 
+u64 perft_bulk(Board *board, int depth, PerftTable *table);
+
+PerftTable *perft_table_create(u64 size_mib);
+
+void perft_table_destroy(PerftTable *table);
+
 void perft_performance_test(void);
 
-void perft_test_from_file(const char *filename, int maxdepth);
+void perft_test_from_file(const char *filename, int maxdepth, u64 hash_mib,
+                          i32 threads);
+
+void perft_divide(Board *board, int depth, bool divide, u64 hash_mib);
+
+void bench(int depth);
+
+void bench_smp(int depth);
+
+void bench_micro(const char *filename);
 
 void puzzle_test(const char *puzzle_db_csv);
 
 void hashing_test();
+
+bool see_test(void);
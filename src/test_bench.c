@@ -0,0 +1,318 @@
+#include "chess.h"
+#include "search.h"
+#include "test.h"
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * Openings, middlegames and endgames, plus a few mates and stalemates.
+ * Most of these come from Stockfish's bench set and the perft suite.
+ */
+static const char *BENCH_POSITIONS[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 10",
+    "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 11",
+    "4rrk1/pp1n3p/3q2pQ/2p1pb2/2PP4/2P3N1/P2B2PP/4RRK1 b - - 7 19",
+    "rq3rk1/ppp2ppp/1bnpb3/3N2B1/3NP3/7P/PPPQ1PP1/2KR3R w - - 7 14",
+    "r1bq1r1k/1pp1n1pp/1p1p4/4p2Q/4Pp2/1BNP4/PPP2PPP/3R1RK1 w - - 2 14",
+    "r3r1k1/2p2ppp/p1p1bn2/8/1q2P3/2NPQN2/PPP3PP/R4RK1 b - - 2 15",
+    "r1bbk1nr/pp3p1p/2n5/1N4p1/2Np1B2/8/PPP2PPP/2KR1B1R w kq - 0 13",
+    "r1bq1rk1/ppp1nppp/4n3/3p3Q/3P4/1BP1B3/PP1N2PP/R4RK1 w - - 1 16",
+    "4r1k1/r1q2ppp/ppp2n2/4P3/5Rb1/1N1BQ3/PPP3PP/R5K1 w - - 1 17",
+    "2rqkb1r/ppp2p2/2npb1p1/1N1Nn2p/2P1PP2/8/PP2B1PP/R1BQK2R b KQ - 0 11",
+    "r1bq1r1k/b1p1npp1/p2p3p/1p6/3PP3/1B2NN2/PP3PPP/R2Q1RK1 w - - 1 16",
+    "3r1rk1/p5pp/bpp1pp2/8/q1PP1P2/b3P3/P2NQRPP/1R2B1K1 b - - 6 22",
+    "r1q2rk1/2p1bppp/2Pp4/p6b/Q1PNp3/4B3/PP1R1PPP/2K4R w - - 2 18",
+    "4k2r/1pb2ppp/1p2p3/1R1p4/3P4/2r1PN2/P4PPP/1R4K1 b - - 3 22",
+    "3q2k1/pb3p1p/4pbp1/2r5/PpN2N2/1P2P2P/5PP1/Q2R2K1 b - - 4 26",
+    "6k1/6p1/6Pp/ppp5/3pn2P/1P3K2/1PP2P2/3N4 b - - 0 1",
+    "3b4/5kp1/1p1p1p1p/pP1PpP1P/P1P1P3/3KN3/8/8 w - - 0 1",
+    "2K5/p7/7P/5pR1/8/5k2/r7/8 w - - 0 1",
+    "8/6pk/1p6/8/PP3p1p/5P2/4KP1q/3Q4 w - - 0 1",
+    "7k/3p2pp/4q3/8/4Q3/5Kp1/P6b/8 w - - 0 1",
+    "8/2p5/8/2kPKp1p/2p4P/2P5/3P4/8 w - - 0 1",
+    "8/1p3pp1/7p/5P1P/2k3P1/8/2K2P2/8 w - - 0 1",
+    "8/pp2r1k1/2p1p3/3pP2p/1P1P1P1P/P5KR/8/8 w - - 0 1",
+    "8/3p4/p1bk3p/Pp6/1Kp1PpPp/2P2P1P/2P5/5B2 b - - 0 1",
+    "5k2/7R/4P2p/5K2/p1r2P1p/8/8/8 b - - 0 1",
+    "6k1/6p1/P6p/r1N5/5p2/7P/1b3PP1/4R1K1 w - - 0 1",
+    "1r3k2/4q3/2Pp3b/3Bp3/2Q2p2/1p1P2P1/1P2KP2/3N4 w - - 0 1",
+    "6k1/4pp1p/3p2p1/P1pPb3/R7/1r2P1PP/3B1P2/6K1 w - - 0 1",
+    "8/3p3B/5p2/5P2/p7/PP5b/k7/6K1 w - - 0 1",
+    "5rk1/q6p/2p3bR/1pPp1rP1/1P1Pp3/P3B1Q1/1K3P2/R7 w - - 93 90",
+    "4rrk1/1p1nq3/p7/2p1P1pp/3P2bp/3Q1Bn1/PPPB4/1K2R1NR w - - 40 21",
+    "r3k2r/3nnpbp/q2pp1p1/p7/Pp1PPPP1/4BNN1/1P5P/R2Q1RK1 w kq - 0 16",
+    "3Qb1k1/1r2ppb1/pN1n2q1/Pp1Pp1Pr/4P2p/4BP2/4B1R1/1R5K b - - 11 40",
+    "4k3/3q1r2/1N2r1b1/3ppN2/2nPP3/1B1R2n1/2R1Q3/3K4 w - - 5 1",
+    "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1",
+    "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+    "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+    "8/k7/3p4/p2P1p2/P2P1P2/8/8/K7 w - - 0 1",
+    "8/8/8/8/5kp1/P7/8/1K1N4 w - - 0 1",
+    "8/8/8/5N2/8/p7/8/2NK3k w - - 0 1",
+    "8/3k4/8/8/8/4B3/4KB2/2B5 w - - 0 1",
+    "8/8/1P6/5pr1/8/4R3/7k/2K5 w - - 0 1",
+    "8/2p4P/8/kr6/6R1/8/8/1K6 w - - 0 1",
+    "8/8/3P3k/8/1p6/8/1P6/1K3n2 b - - 0 1",
+    "8/R7/2q5/8/6k1/8/1P5p/K6R w - - 0 124",
+    "6k1/3b3r/1p1p4/p1n2p2/1PPNpP1q/P3Q1p1/1R1RB1P1/5K2 b - - 0 1",
+    "r2r1n2/pp2bk2/2p1p2p/3q4/3PN1QP/2P3R1/P4PP1/5RK1 w - - 0 1",
+    "8/8/8/8/8/6k1/6p1/6K1 w - - 0 1",
+    "7k/7P/6K1/8/3B4/8/8/8 b - - 0 1",
+};
+
+static void bench_run(int depth, bool print_positions, u64 *out_nodes,
+                      u64 *out_time_ms) {
+  const int position_count =
+      (int)(sizeof(BENCH_POSITIONS) / sizeof(BENCH_POSITIONS[0]));
+  Board *board = calloc(1, sizeof(Board));
+  AtomicBool stop_thinking = false;
+  u64 total_nodes = 0;
+  struct timespec start, stop;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+  for (int i = 0; i < position_count; i++) {
+    clear_tables();
+    board_initialize_fen(board, BENCH_POSITIONS[i], NULL);
+    Move best_move = 0;
+    const u64 nodes =
+        search(board, &best_move, &stop_thinking, NULL, depth - 1);
+    if (print_positions) {
+      char move_buf[16] = "0000"; // no legal moves
+      if (best_move) {
+        move_to_string(best_move, move_buf);
+      }
+      printf("Position %i/%i: %llu nodes, bestmove %s\n", i + 1,
+             position_count, (unsigned long long)nodes, move_buf);
+    }
+    total_nodes += nodes;
+  }
+  clock_gettime(CLOCK_MONOTONIC_RAW, &stop);
+  clear_tables();
+  free(board);
+  u64 execution_time_ms = (stop.tv_sec - start.tv_sec) * 1000 +
+                          (stop.tv_nsec - start.tv_nsec) / 1000000;
+  if (execution_time_ms == 0) {
+    execution_time_ms = 1;
+  }
+  *out_nodes = total_nodes;
+  *out_time_ms = execution_time_ms;
+}
+
+/**
+ * Searches every bench position to a fixed depth, clearing the hash tables
+ * before each one. The total node count only depends on the search and
+ * evaluation, so it is a signature for functional changes, while nps tracks
+ * speed. The signature is only deterministic with one search thread.
+ */
+void bench(int depth) {
+  u64 total_nodes;
+  u64 execution_time_ms;
+  bench_run(depth, true, &total_nodes, &execution_time_ms);
+  printf("===========================\n");
+  printf("Total time (ms) : %llu\n", (unsigned long long)execution_time_ms);
+  printf("Nodes searched  : %llu\n", (unsigned long long)total_nodes);
+  printf("Nodes/second    : %llu\n",
+         (unsigned long long)(total_nodes * 1000 / execution_time_ms));
+}
+
+/**
+ * Runs bench with 1, 2, 4, 8 and 16 search threads, reporting time to reach
+ * depth and nps relative to one thread.
+ */
+void bench_smp(int depth) {
+  static const i32 thread_counts[] = {1, 2, 4, 8, 16};
+  const i32 previous_threads = search_get_threads();
+  u64 base_time_ms = 0;
+  u64 base_nps = 0;
+  printf("threads    time (ms)          nodes          nps  time-to-depth  "
+         "nps-scaling\n");
+  for (int k = 0; k < (int)(sizeof(thread_counts) / sizeof(i32)); k++) {
+    search_set_threads(thread_counts[k]);
+    u64 nodes;
+    u64 time_ms;
+    bench_run(depth, false, &nodes, &time_ms);
+    const u64 nps = nodes * 1000 / time_ms;
+    if (k == 0) {
+      base_time_ms = time_ms;
+      base_nps = nps > 0 ? nps : 1;
+    }
+    printf("%7i %12llu %14llu %12llu %13.2fx %11.2fx\n", thread_counts[k],
+           (unsigned long long)time_ms, (unsigned long long)nodes,
+           (unsigned long long)nps, (f64)base_time_ms / (f64)time_ms,
+           (f64)nps / (f64)base_nps);
+  }
+  search_set_threads(previous_threads);
+}
+
+/**
+ * Each micro benchmark runs one batch of operations on a position and returns
+ * how many operations that was. moves holds the position's legal moves,
+ * generated before timing starts. Results are folded into micro_bench_sink so
+ * the compiler can't drop the work.
+ */
+typedef u64 (*MicroBenchFunction)(Board *board, MoveList *moves);
+
+static volatile u64 micro_bench_sink;
+
+static u64 micro_bench_legal_moves(Board *board, MoveList *moves) {
+  (void)moves;
+  MoveList legal_moves = generate_all_legal_moves(board);
+  micro_bench_sink += legal_moves.count;
+  return 1;
+}
+
+static u64 micro_bench_capture_moves(Board *board, MoveList *moves) {
+  (void)moves;
+  MoveList capture_moves = generate_capture_moves(board);
+  micro_bench_sink += capture_moves.count;
+  return 1;
+}
+
+static u64 micro_bench_make_unmake(Board *board, MoveList *moves) {
+  for (int i = 0; i < moves->count; i++) {
+    board_make_move(board, move_list_get(moves, i));
+    micro_bench_sink += board->_bitboard[kWhite];
+    board_unmake(board);
+  }
+  return moves->count;
+}
+
+static u64 micro_bench_evaluation(Board *board, MoveList *moves) {
+  (void)moves;
+  micro_bench_sink += evaluation(board);
+  return 1;
+}
+
+static u64 micro_bench_position_hash(Board *board, MoveList *moves) {
+  (void)moves;
+  micro_bench_sink += board_position_hash(board);
+  return 1;
+}
+
+static u64 micro_bench_is_attacked(Board *board, MoveList *moves) {
+  (void)moves;
+  const i32 enemy = board->_turn == kWhite ? kBlack : kWhite;
+  u64 attacked = 0;
+  for (u32 sq = 0; sq < 64; sq++) {
+    attacked += is_attacked((u64)1 << sq, board->_bitboard, enemy);
+  }
+  micro_bench_sink += attacked;
+  return 64;
+}
+
+static u64 micro_bench_pass(MicroBenchFunction fn, Board **boards,
+                            MoveList *moves, int board_count,
+                            int rounds) {
+  u64 ops = 0;
+  for (int r = 0; r < rounds; r++) {
+    for (int b = 0; b < board_count; b++) {
+      ops += fn(boards[b], &moves[b]);
+    }
+  }
+  return ops;
+}
+
+static u64 now_ns(void) {
+  struct timespec tick;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &tick);
+  return (u64)tick.tv_sec * 1000000000 + (u64)tick.tv_nsec;
+}
+
+/**
+ * Warms up and calibrates the number of rounds over the corpus so one sample
+ * takes about 20 ms, then reports the mean, best and standard deviation of the
+ * per-operation time over a fixed number of samples.
+ */
+static void micro_bench_run(const char *name, MicroBenchFunction fn,
+                            Board **boards, MoveList *moves,
+                            int board_count) {
+#define MICRO_BENCH_SAMPLES 10
+#define MICRO_BENCH_SAMPLE_NS 20000000
+  int rounds = 1;
+  while (1) {
+    const u64 start = now_ns();
+    micro_bench_pass(fn, boards, moves, board_count, rounds);
+    if (now_ns() - start >= MICRO_BENCH_SAMPLE_NS / 2 || rounds >= 1 << 20) {
+      break;
+    }
+    rounds *= 2;
+  }
+  f64 ns_per_op[MICRO_BENCH_SAMPLES];
+  f64 mean = 0;
+  f64 best = 0;
+  for (int s = 0; s < MICRO_BENCH_SAMPLES; s++) {
+    const u64 start = now_ns();
+    const u64 ops = micro_bench_pass(fn, boards, moves, board_count, rounds);
+    const u64 elapsed = now_ns() - start;
+    ns_per_op[s] = ops ? (f64)elapsed / (f64)ops : 0;
+    mean += ns_per_op[s] / MICRO_BENCH_SAMPLES;
+    if (s == 0 || ns_per_op[s] < best) {
+      best = ns_per_op[s];
+    }
+  }
+  f64 variance = 0;
+  for (int s = 0; s < MICRO_BENCH_SAMPLES; s++) {
+    variance += (ns_per_op[s] - mean) * (ns_per_op[s] - mean) /
+                MICRO_BENCH_SAMPLES;
+  }
+  printf("%-24s %9.1f ns/op  best %9.1f  sd %7.1f  %12.0f ops/s\n", name, mean,
+         best, sqrt(variance), mean > 0 ? 1e9 / mean : 0);
+#undef MICRO_BENCH_SAMPLES
+#undef MICRO_BENCH_SAMPLE_NS
+}
+
+/**
+ * Times move generation, make/unmake, evaluation, hashing and attack
+ * detection separately over every position in an EPD file, so an
+ * optimization can be attributed to the component it touched.
+ */
+void bench_micro(const char *filename) {
+  FILE *fp = fopen(filename, "r");
+  if (fp == NULL) {
+    printf("Error opening bench corpus %s\n", filename);
+    return;
+  }
+#define LINE_BUFFER_SIZE 1024
+  char buffer[LINE_BUFFER_SIZE];
+  int board_count = 0;
+  int board_capacity = 64;
+  Board **boards = malloc(sizeof(Board *) * board_capacity);
+  while (fgets(buffer, LINE_BUFFER_SIZE, fp)) {
+    if (buffer[0] == '\n' || buffer[0] == '\0') {
+      continue;
+    }
+    if (board_count == board_capacity) {
+      board_capacity *= 2;
+      boards = realloc(boards, sizeof(Board *) * board_capacity);
+    }
+    boards[board_count] = calloc(1, sizeof(Board));
+    board_initialize_fen(boards[board_count], buffer, NULL);
+    board_count++;
+  }
+#undef LINE_BUFFER_SIZE
+  fclose(fp);
+  MoveList *moves = malloc(sizeof(MoveList) * board_count);
+  for (int b = 0; b < board_count; b++) {
+    moves[b] = generate_all_legal_moves(boards[b]);
+  }
+  printf("Micro benchmarks over %i positions from %s\n", board_count,
+         filename);
+  micro_bench_run("generate_all_legal_moves", micro_bench_legal_moves, boards,
+                  moves, board_count);
+  micro_bench_run("generate_capture_moves", micro_bench_capture_moves, boards,
+                  moves, board_count);
+  micro_bench_run("make_move/unmake", micro_bench_make_unmake, boards, moves,
+                  board_count);
+  micro_bench_run("evaluation", micro_bench_evaluation, boards, moves,
+                  board_count);
+  micro_bench_run("board_position_hash", micro_bench_position_hash, boards,
+                  moves, board_count);
+  micro_bench_run("is_attacked", micro_bench_is_attacked, boards, moves,
+                  board_count);
+  for (int b = 0; b < board_count; b++) {
+    free(boards[b]);
+  }
+  free(boards);
+  free(moves);
+}
@@ -1,5 +1,6 @@
 #include "chess.h"
 #include "test.h"
+#include "uci.h"
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,6 +11,7 @@ PerftResults perft_helper(Board *board, int depth, int top_depth);
 void perft_performance_test(void) {
   const int n = 10;
   u64 *timer_data = malloc(sizeof(u64) * n);
+  printf("Slider attack backend: %s\n", slider_backend_name());
   printf("Running and checking perft(5) from start position, %i times\n", n);
   u64 correct = 4865609;
   Board *board = calloc(1, sizeof(Board));
@@ -25,7 +27,11 @@ void perft_performance_test(void) {
       printf("FAILED PERFT(5)\n");
       return;
     }
-    printf("Time: %i ms\n", (int)execution_time_ms);
+    if (execution_time_ms == 0) {
+      execution_time_ms = 1;
+    }
+    printf("Time: %i ms (%llu nps)\n", (int)execution_time_ms,
+           (unsigned long long)(correct * 1000 / execution_time_ms));
     timer_data[i] = execution_time_ms;
   }
   u64 mean = 0;
@@ -33,12 +39,29 @@ void perft_performance_test(void) {
     mean += timer_data[i];
   }
   mean /= n;
-  printf("Average over %i attempts: %i ms\n", n, (int)mean);
+  printf("Average over %i attempts: %i ms (%llu nps)\n", n, (int)mean,
+         (unsigned long long)(correct * 1000 / (mean ? mean : 1)));
+  {
+    struct timespec start, stop;
+    board_initialize_startpos(board);
+    clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+    const u64 nodes = perft_bulk(board, 5, NULL);
+    clock_gettime(CLOCK_MONOTONIC_RAW, &stop);
+    u64 execution_time_ms = (stop.tv_sec - start.tv_sec) * 1000 +
+                            (stop.tv_nsec - start.tv_nsec) / 1000000;
+    if (execution_time_ms == 0) {
+      execution_time_ms = 1;
+    }
+    printf("Bulk-counting perft(5)%s: %i ms (%llu nps)\n",
+           nodes == correct ? "" : " FAILED", (int)execution_time_ms,
+           (unsigned long long)(nodes * 1000 / execution_time_ms));
+  }
   free(timer_data);
   free(board);
 }
 
-bool parse_depth_count(char *line, int *i, int *out_depth, int *out_count) {
+bool parse_depth_count(char *line, int *i, int *out_depth,
+                       u64 *out_count) {
   int depth_start = -1;
   int count_start = -1;
   if (*i >= (int)strlen(line))
@@ -56,46 +79,114 @@ bool parse_depth_count(char *line, int *i, int *out_depth, int *out_count) {
     (*i)++;
   }
   *out_depth = atoi(line + depth_start);
-  *out_count = atoi(line + count_start);
+  *out_count = strtoull(line + count_start, NULL, 10);
   return true;
 }
 
-bool perft_test_line(char *line, int max_depth) {
-  int i = 0;
-  char c = '\0';
-  while (c != ';') {
-    c = line[i];
-    i++;
-  }
-  int depth, count;
+/**
+ * One root move of one test case, the unit of work handed to perft workers.
+ */
+typedef struct PerftJob {
+  const char *fen;
+  Move mv;
+  int depth; // remaining after mv is made
+  int case_idx;
+  u64 nodes;
+  u64 time_us;
+} PerftJob;
+
+typedef struct PerftCase {
+  int line_idx;
+  int depth;
+  u64 expected;
+  u64 nodes;
+  u64 time_us;
+} PerftCase;
+
+typedef struct PerftPool {
+  PerftJob *jobs;
+  i32 job_count;
+  AtomicInt next_job;
+  PerftTable *table;
+} PerftPool;
+
+static u64 elapsed_us(struct timespec *start, struct timespec *stop) {
+  return (u64)(stop->tv_sec - start->tv_sec) * 1000000 +
+         (u64)((stop->tv_nsec - start->tv_nsec) / 1000);
+}
+
+/**
+ * Each worker owns its Board and only re-parses the FEN when it picks up a
+ * job from a different position.
+ */
+#if defined(_WIN32) || defined(WIN32)
+DWORD WINAPI
+#else
+void *
+#endif
+perft_worker(void *arg) {
+  PerftPool *pool = arg;
   Board *board = calloc(1, sizeof(Board));
-  board_initialize_fen(board, line, NULL);
-  int cases = 0;
-  int passes = 0;
+  const char *loaded_fen = NULL;
   while (1) {
-    bool parse_result = parse_depth_count(line, &i, &depth, &count);
-    if (!parse_result) {
+    const i32 job_idx = ATOMIC_FETCH_ADD(&pool->next_job, 1);
+    if (job_idx >= pool->job_count) {
       break;
     }
-    if (depth > max_depth)
-      continue;
-    PerftResults pr = perft(board, depth);
-    cases++;
-    if ((int)pr.nodes == count) {
-      passes++;
+    PerftJob *job = &pool->jobs[job_idx];
+    struct timespec start, stop;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+    if (job->fen != loaded_fen) {
+      board_initialize_fen(board, job->fen, NULL);
+      loaded_fen = job->fen;
     }
+    board_make_move(board, job->mv);
+    job->nodes = perft_bulk(board, job->depth, pool->table);
+    board_unmake(board);
+    clock_gettime(CLOCK_MONOTONIC_RAW, &stop);
+    job->time_us = elapsed_us(&start, &stop);
   }
   free(board);
-  if (passes == cases) {
-    printf("PASSED %i cases\n", cases);
-    return true;
-  } else {
-    printf("FAIL\n");
-    return false;
+  return 0;
+}
+
+static int perft_job_compare_depth(const void *a, const void *b) {
+  return ((const PerftJob *)b)->depth - ((const PerftJob *)a)->depth;
+}
+
+/**
+ * Runs jobs on a pool of threads, deepest first so that long jobs don't end
+ * up running alone at the end.
+ */
+static void perft_pool_run(PerftJob *jobs, i32 job_count, PerftTable *table,
+                           i32 threads) {
+  PerftPool pool;
+  pool.jobs = jobs;
+  pool.job_count = job_count;
+  pool.next_job = 0;
+  pool.table = table;
+  qsort(jobs, job_count, sizeof(PerftJob), perft_job_compare_depth);
+  if (threads < 1) {
+    threads = 1;
+  }
+  THREAD *workers = malloc(sizeof(THREAD) * threads);
+  for (i32 t = 0; t < threads; t++) {
+    THREAD_CREATE(&workers[t], NULL, perft_worker, (void *)&pool);
   }
+  for (i32 t = 0; t < threads; t++) {
+    THREAD_JOIN(workers[t], NULL);
+  }
+  free(workers);
 }
 
-void perft_test_from_file(const char *filename, int max_depth) {
+/**
+ * Runs every case up to max_depth with bulk counting on a pool of threads,
+ * splitting each case at the root. A perft table of hash_mib MiB (0 to
+ * disable it) is shared between threads.
+ * Per-position time is the sum of its jobs' time across threads.
+ */
+void perft_test_from_file(const char *filename, int max_depth, u64 hash_mib,
+                          i32 threads) {
   FILE *fp;
 #define LINE_BUFFER_SIZE 1024
   char buffer[LINE_BUFFER_SIZE];
@@ -104,19 +195,167 @@ void perft_test_from_file(const char *filename, int max_depth) {
     printf("Error opening test case file.");
     return;
   }
-  int cases = 0;
-  int passes = 0;
+  i32 line_count = 0;
+  i32 line_capacity = 64;
+  char **lines = malloc(sizeof(char *) * line_capacity);
   while (fgets(buffer, LINE_BUFFER_SIZE, fp)) {
-    if (perft_test_line(buffer, max_depth)) {
-      passes++;
+    if (line_count == line_capacity) {
+      line_capacity *= 2;
+      lines = realloc(lines, sizeof(char *) * line_capacity);
     }
-    cases++;
+    lines[line_count] = malloc(strlen(buffer) + 1);
+    strcpy(lines[line_count], buffer);
+    line_count++;
   }
 #undef LINE_BUFFER_SIZE
   fclose(fp);
-  if (passes == cases) {
+  i32 case_count = 0;
+  i32 case_capacity = 256;
+  PerftCase *cases = malloc(sizeof(PerftCase) * case_capacity);
+  i32 job_count = 0;
+  i32 job_capacity = 4096;
+  PerftJob *jobs = malloc(sizeof(PerftJob) * job_capacity);
+  Board *board = calloc(1, sizeof(Board));
+  for (i32 l = 0; l < line_count; l++) {
+    char *line = lines[l];
+    int i = 0;
+    char c = '\0';
+    while (c != ';' && line[i] != '\0') {
+      c = line[i];
+      i++;
+    }
+    board_initialize_fen(board, line, NULL);
+    MoveList root_moves = generate_all_legal_moves(board);
+    int depth;
+    u64 count;
+    while (parse_depth_count(line, &i, &depth, &count)) {
+      if (depth > max_depth) {
+        continue;
+      }
+      if (case_count == case_capacity) {
+        case_capacity *= 2;
+        cases = realloc(cases, sizeof(PerftCase) * case_capacity);
+      }
+      PerftCase *c = &cases[case_count];
+      c->line_idx = l;
+      c->depth = depth;
+      c->expected = count;
+      c->nodes = 0;
+      c->time_us = 0;
+      for (i32 m = 0; m < root_moves.count; m++) {
+        if (job_count == job_capacity) {
+          job_capacity *= 2;
+          jobs = realloc(jobs, sizeof(PerftJob) * job_capacity);
+        }
+        PerftJob *job = &jobs[job_count++];
+        job->fen = line;
+        job->mv = move_list_get(&root_moves, m);
+        job->depth = depth - 1;
+        job->case_idx = case_count;
+        job->nodes = 0;
+        job->time_us = 0;
+      }
+      case_count++;
+    }
+  }
+  free(board);
+  PerftTable *table = perft_table_create(hash_mib);
+  struct timespec start, stop;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+  perft_pool_run(jobs, job_count, table, threads);
+  clock_gettime(CLOCK_MONOTONIC_RAW, &stop);
+  perft_table_destroy(table);
+  for (i32 j = 0; j < job_count; j++) {
+    cases[jobs[j].case_idx].nodes += jobs[j].nodes;
+    cases[jobs[j].case_idx].time_us += jobs[j].time_us;
+  }
+  int positions = 0;
+  int passes = 0;
+  u64 total_nodes = 0;
+  for (i32 c = 0; c < case_count;) {
+    const int line_idx = cases[c].line_idx;
+    int line_cases = 0;
+    int line_passes = 0;
+    u64 line_nodes = 0;
+    u64 line_time_us = 0;
+    for (; c < case_count && cases[c].line_idx == line_idx; c++) {
+      line_cases++;
+      if (cases[c].nodes == cases[c].expected) {
+        line_passes++;
+      }
+      line_nodes += cases[c].nodes;
+      line_time_us += cases[c].time_us;
+    }
+    if (line_time_us == 0) {
+      line_time_us = 1;
+    }
+    printf("%s %i cases, %llu nodes, %llu ms, %llu nps\n",
+           line_passes == line_cases ? "PASSED" : "FAIL", line_cases,
+           (unsigned long long)line_nodes,
+           (unsigned long long)(line_time_us / 1000),
+           (unsigned long long)(line_nodes * 1000000 / line_time_us));
+    positions++;
+    if (line_passes == line_cases) {
+      passes++;
+    }
+    total_nodes += line_nodes;
+  }
+  u64 wall_time_us = elapsed_us(&start, &stop);
+  if (wall_time_us == 0) {
+    wall_time_us = 1;
+  }
+  printf("Total: %llu nodes, %llu ms, %llu nps, %i threads\n",
+         (unsigned long long)total_nodes,
+         (unsigned long long)(wall_time_us / 1000),
+         (unsigned long long)(total_nodes * 1000000 / wall_time_us),
+         (int)threads);
+  if (passes == positions) {
     printf("Passed all Perft test cases.\n");
   }
+  for (i32 l = 0; l < line_count; l++) {
+    free(lines[l]);
+  }
+  free(lines);
+  free(cases);
+  free(jobs);
+}
+
+/**
+ * Perft on an arbitrary position, for the UCI `perft` command. With divide,
+ * prints the node count below each root move, which makes it easy to bisect a
+ * move generator bug against another engine.
+ */
+void perft_divide(Board *board, int depth, bool divide, u64 hash_mib) {
+  PerftTable *table = perft_table_create(hash_mib);
+  struct timespec start, stop;
+  u64 nodes = 0;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &start);
+  if (depth < 1) {
+    nodes = 1;
+  } else {
+    MoveList moves = generate_all_legal_moves(board);
+    for (int i = 0; i < moves.count; i++) {
+      const Move mv = move_list_get(&moves, i);
+      board_make_move(board, mv);
+      const u64 move_nodes = perft_bulk(board, depth - 1, table);
+      board_unmake(board);
+      if (divide) {
+        char move_buf[16];
+        move_to_string(mv, move_buf);
+        printf("%s: %llu\n", move_buf, (unsigned long long)move_nodes);
+      }
+      nodes += move_nodes;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC_RAW, &stop);
+  perft_table_destroy(table);
+  u64 time_us = elapsed_us(&start, &stop);
+  if (time_us == 0) {
+    time_us = 1;
+  }
+  printf("Nodes searched: %llu\n", (unsigned long long)nodes);
+  printf("Time: %llu ms\n", (unsigned long long)(time_us / 1000));
+  printf("nps: %llu\n", (unsigned long long)(nodes * 1000000 / time_us));
 }
 
 PerftResults perft(Board *board, int depth) {
@@ -165,3 +404,63 @@ PerftResults perft_helper(Board *board, int depth, int top_depth) {
   }
   return r;
 }
+
+/**
+ * Perft node count only. Leaves are counted at depth 1 without being made,
+ * and subtrees of depth 2 and up are looked up in / stored to table (which
+ * may be NULL).
+ */
+u64 perft_bulk(Board *board, int depth, PerftTable *table) {
+  if (depth == 0) {
+    return 1;
+  }
+  if (depth == 1) {
+    return (u64)board_legal_moves_count(board);
+  }
+  const u64 hash = board_metadata_peek(board, 0)->_hash;
+  PerftTableEntry *entry = NULL;
+  if (table) {
+    entry = &table->entries[hash & table->mask];
+    const u64 key = entry->key;
+    const u64 data = entry->data;
+    if ((key ^ data) == hash && (int)(data & 0xff) == depth) {
+      return data >> 8;
+    }
+  }
+  u64 nodes = 0;
+  MoveList moves = generate_all_legal_moves(board);
+  for (int i = 0; i < moves.count; i++) {
+    board_make_move(board, move_list_get(&moves, i));
+    nodes += perft_bulk(board, depth - 1, table);
+    board_unmake(board);
+  }
+  if (entry) {
+    const u64 data = (nodes << 8) | (u64)depth;
+    entry->key = hash ^ data;
+    entry->data = data;
+  }
+  return nodes;
+}
+
+PerftTable *perft_table_create(u64 size_mib) {
+  if (size_mib == 0) {
+    return NULL;
+  }
+  const u64 size_b = size_mib * 1024 * 1024;
+  u64 count = 1;
+  while (count * 2 * sizeof(PerftTableEntry) <= size_b) {
+    count *= 2;
+  }
+  PerftTable *table = malloc(sizeof(PerftTable));
+  table->count = count;
+  table->mask = count - 1;
+  table->entries = calloc(count, sizeof(PerftTableEntry));
+  return table;
+}
+
+void perft_table_destroy(PerftTable *table) {
+  if (table) {
+    free(table->entries);
+    free(table);
+  }
+}
@@ -5,6 +5,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * Every puzzle gets the same number of nodes rather than the same depth, so
+ * solve rates stay comparable across changes to pruning and extensions.
+ */
+#define PUZZLE_NODE_BUDGET 200000
+#define PUZZLE_MAX_DEPTH 64
+
 static AtomicBool stop_thinking;
 static Move best_move;
 static u64 think_ms;
@@ -79,7 +86,7 @@ bool puzzle_test_line(const char *line, Board *board) {
   stop_thinking = false;
   //THREAD think_timer_thread;
   //THREAD_CREATE(&think_timer_thread, NULL, puzzle_think_timer, (void *)NULL);
-  search(board, &best_move, &stop_thinking, NULL, 5);
+  search(board, &best_move, &stop_thinking, NULL, PUZZLE_MAX_DEPTH);
   char move_buf[16];
   move_to_string(best_move, move_buf);
   // printf("Found move: %s\n", move_buf);
@@ -109,6 +116,7 @@ void puzzle_test(const char *puzzle_db_csv) {
   }
   Board *board = calloc(1, sizeof(Board));
   int limit = 1000;
+  search_set_node_limit(PUZZLE_NODE_BUDGET);
   fgets(buffer, LINE_BUFFER_SIZE, fp); // skip first line
   int i = 0;
   int correct = 0;
@@ -120,8 +128,10 @@ void puzzle_test(const char *puzzle_db_csv) {
     total++;
     i++;
   }
-  printf("%i/%i puzzles correct first move (%0.2f percent)\n", correct, total,
-         100.0 * (float)correct / (float)total);
+  search_set_node_limit(0);
+  printf("%i/%i puzzles correct first move (%0.2f percent) at %i nodes\n",
+         correct, total, 100.0 * (float)correct / (float)total,
+         PUZZLE_NODE_BUDGET);
   free(board);
 #undef LINE_BUFFER_SIZE
 }
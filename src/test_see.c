@@ -0,0 +1,71 @@
+#include "chess.h"
+#include "test.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct SeeCase {
+  const char *fen;
+  const char *move;
+  i32 expected;
+} SeeCase;
+
+/**
+ * Expected values use the SEE piece values: pawn 100, knight and bishop 300,
+ * rook 500, queen 900.
+ */
+static const SeeCase SEE_CASES[] = {
+    // undefended pawn
+    {"1k1r4/1pp4p/p7/4p3/8/P5P1/1PP4P/2K1R3 w - - 0 1", "e1e5", 100},
+    // x-rays on both sides: queen behind rook, queen behind bishop
+    {"1k1r3q/1ppn3p/p4b2/4p3/8/P2N2P1/1PP1R1BP/2K1Q3 w - - 0 1", "d3e5", -200},
+    {"4k3/8/2p5/3p4/4P3/8/8/4K3 w - - 0 1", "e4d5", 0},
+    {"4k3/8/2p5/3p4/8/8/8/3QK3 w - - 0 1", "d1d5", -800},
+    // doubled rooks: the rear one recaptures through the front one
+    {"3rk3/8/8/3p4/8/8/3R4/3RK3 w - - 0 1", "d2d5", 100},
+    {"3rk3/3r4/8/3p4/8/8/3R4/3QK3 w - - 0 1", "d2d5", -400},
+    {"4k3/8/8/3pP3/8/8/8/4K3 w - d6 0 1", "e5d6", 100},
+    // promotions: the new piece is what gets recaptured
+    {"4k3/P7/8/8/8/8/8/4K3 w - - 0 1", "a7a8q", 800},
+    {"3rk3/2P5/8/8/8/8/8/4K3 w - - 0 1", "c7d8q", 400},
+    // the king can't recapture on a square the rook x-rays through
+    {"1rk5/P7/8/8/8/8/8/1R2K3 w - - 0 1", "a7b8q", 1300},
+};
+
+/**
+ * Checks static_exchange_evaluation against hand-computed exchanges.
+ * Returns true if every case matches.
+ */
+bool see_test(void) {
+  const i32 count = (i32)(sizeof(SEE_CASES) / sizeof(SEE_CASES[0]));
+  i32 passed = 0;
+  Board *board = calloc(1, sizeof(Board));
+  for (i32 c = 0; c < count; c++) {
+    const SeeCase *see_case = &SEE_CASES[c];
+    board_initialize_fen(board, see_case->fen, NULL);
+    MoveList moves = generate_all_legal_moves(board);
+    bool found = false;
+    for (i32 i = 0; i < moves.count; i++) {
+      const Move mv = move_list_get(&moves, i);
+      char move_buf[16];
+      move_to_string(mv, move_buf);
+      if (strcmp(move_buf, see_case->move) != 0) {
+        continue;
+      }
+      found = true;
+      const i32 value = static_exchange_evaluation(board, mv);
+      if (value == see_case->expected) {
+        passed++;
+      } else {
+        printf("FAIL %s %s: got %i, expected %i\n", see_case->fen,
+               see_case->move, value, see_case->expected);
+      }
+      break;
+    }
+    if (!found) {
+      printf("FAIL %s: %s is not legal\n", see_case->fen, see_case->move);
+    }
+  }
+  free(board);
+  printf("SEE: %i/%i cases passed\n", passed, count);
+  return passed == count;
+}
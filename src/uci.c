@@ -10,6 +10,10 @@
 #include <string.h>
 #include <time.h>
 
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#include <unistd.h>
+#endif
+
 #ifdef __linux__
 #include <valgrind/callgrind.h>
 #endif
@@ -20,9 +24,26 @@ void THREAD_CREATE(THREAD* t, void* attr, LPTHREAD_START_ROUTINE f, void*arg) {
     *t = CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE) f, arg, 0, NULL);
 }
 
+void THREAD_JOIN(THREAD t, void **unused) {
+    (void)unused;
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+
 void THREAD_DETACH(THREAD t) {
     CloseHandle(t);
 }
+
+i32 hardware_thread_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (i32)info.dwNumberOfProcessors;
+}
+#else
+i32 hardware_thread_count(void) {
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (i32)count : 1;
+}
 #endif
 
 static const char *ENGINE_NAME = "Blobfish2";
@@ -63,15 +84,21 @@ void command_help(char *line_buffer);
 
 void command_gen_data(char *line_buffer);
 
+void command_bench(char *line_buffer);
+
+void command_hash(char *line_buffer);
+
 void engine_command(char *line_buffer) {
-#define COMMAND_COUNT 12
+#define COMMAND_COUNT 15
   static char *commands[COMMAND_COUNT] = {
       "quit",    "test", "uci",  "perft", "position", "ucinewgame",
-      "isready", "go",   "stop", "dump",  "help", "gen"};
+      "isready", "go",   "stop", "dump",  "help", "gen", "bench", "setoption",
+      "hash"};
   static const cmd_func command_functions[COMMAND_COUNT] = {
       command_quit,     command_test,       command_uci,     command_perft,
       command_position, command_ucinewgame, command_isready, command_go,
-      command_stop,     command_dump,       command_help, command_gen_data};
+      command_stop,     command_dump,       command_help, command_gen_data,
+      command_bench,    command_setoption,  command_hash};
 
   fprintf(ctx->log_fp, "INFO: GUI command `%.*s`\n",
           (int)strlen(line_buffer) - 1, line_buffer);
@@ -90,6 +117,8 @@ void engine_command(char *line_buffer) {
 #undef COMMAND_COUNT
 }
 
+static THREAD think_timer_thread;
+
 #if defined(_WIN32) || defined(WIN32)
 DWORD WINAPI
 #else
@@ -138,14 +167,31 @@ think(void *_unused) {
   move_to_string(ctx->best_move, move_buf);
   printf("bestmove %s\n", move_buf);
   ctx->stop_thinking = true;
+  THREAD_JOIN(think_timer_thread, NULL);
+  // Only now are the search and timer threads done with ctx and the tables.
+  ctx->searching = false;
   // TODO: ponder
   return 0;
 }
 
+/**
+ * Commands that use the board or the shared tables are refused while the
+ * think thread is running. Returns true, after telling the GUI, if command
+ * must be refused.
+ */
+static bool refuse_while_searching(const char *command) {
+  if (!ctx->searching) {
+    return false;
+  }
+  printf("info string %s ignored while searching\n", command);
+  return true;
+}
+
 void command_go(char *line_buffer) {
   enum number_args { kWTime, kBTime, kMovesToGo, kMoveTime };
-  if (!ctx->stop_thinking) // ignore if already going
+  if (ctx->searching) // ignore if already going, or still winding down
     return;
+  ctx->searching = true;
   ctx->stop_thinking = false;
   i32 arguments[4] = {-1, -1, -1, -1};
   int i = 0;
@@ -182,9 +228,8 @@ void command_go(char *line_buffer) {
   }
   // printf("info decided to think for %i ms\n", (int) ctx->think_time_ms);
   ctx->stop_thinking = false;
-  THREAD think_timer_thread;
+  // Joined by the think thread once the search is done.
   THREAD_CREATE(&think_timer_thread, NULL, think_timer, (void *)NULL);
-  THREAD_DETACH(think_timer_thread);
   THREAD think_thread;
   THREAD_CREATE(&think_thread, NULL, think, (void *)NULL);
   THREAD_DETACH(think_thread);
@@ -201,18 +246,141 @@ void command_stop(char *line_buffer) {
   stop_searching();
 }
 
+/**
+ * perft <depth> [divide]
+ * Runs on the current position. Ignored while a search is running, since
+ * both would make moves on ctx->board.
+ */
 void command_perft(char *line_buffer) {
-  (void)line_buffer;
-  // TODO: perft command for position
-  // printf("perft %s\n", line_buffer);
+  if (refuse_while_searching("perft")) {
+    return;
+  }
+  int i = 0;
+  char word_buffer[64];
+  int depth = 1;
+  bool divide = false;
+  if (eat_word(line_buffer, word_buffer, &i)) {
+    depth = atoi(word_buffer);
+  }
+  while (eat_word(line_buffer, word_buffer, &i)) {
+    if (strings_equal("divide", word_buffer)) {
+      divide = true;
+    }
+  }
+  perft_divide(ctx->board, depth, divide, 64);
+}
+
+/**
+ * bench [depth]
+ * bench micro [epd file]
+ * bench smp [depth]
+ * Uses the shared hash tables, so it is ignored while a search is running.
+ */
+void command_bench(char *line_buffer) {
+  if (refuse_while_searching("bench")) {
+    return;
+  }
+  int i = 0;
+  char word_buffer[256];
+  int depth = 5;
+  if (eat_word(line_buffer, word_buffer, &i)) {
+    if (strings_equal("micro", word_buffer)) {
+      if (eat_word(line_buffer, word_buffer, &i)) {
+        bench_micro(word_buffer);
+      } else {
+        bench_micro("./test/standard.epd");
+      }
+      return;
+    }
+    if (strings_equal("smp", word_buffer)) {
+      if (eat_word(line_buffer, word_buffer, &i)) {
+        depth = atoi(word_buffer);
+      }
+      bench_smp(depth);
+      return;
+    }
+    depth = atoi(word_buffer);
+  }
+  bench(depth);
+}
+
+/**
+ * hash save <file>
+ * hash load <file>
+ * Snapshots the transposition table, e.g. to resume a long analysis after a
+ * restart. Ignored while a search is running.
+ */
+void command_hash(char *line_buffer) {
+  if (refuse_while_searching("hash")) {
+    return;
+  }
+  int i = 0;
+  char word_buffer[64];
+  char filename[1024];
+  if (!eat_word(line_buffer, word_buffer, &i) ||
+      !eat_word(line_buffer, filename, &i)) {
+    printf("info string usage: hash save|load <file>\n");
+    return;
+  }
+  if (strings_equal("save", word_buffer)) {
+    if (ttable_save_file(filename)) {
+      printf("info string saved hash table to %s\n", filename);
+    }
+  } else if (strings_equal("load", word_buffer)) {
+    if (ttable_load_file(filename)) {
+      printf("info string loaded hash table from %s\n", filename);
+    }
+  }
+}
+
+/**
+ * setoption name <id> [value <x>]
+ * Ignored while a search is running.
+ */
+void command_setoption(char *line_buffer) {
+  if (refuse_while_searching("setoption")) {
+    return;
+  }
+  int i = 0;
+  char word_buffer[64];
+  char name[128] = "";
+  char value[64] = "";
+  eat_word(line_buffer, word_buffer, &i); // "name"
+  while (eat_word(line_buffer, word_buffer, &i)) {
+    if (strings_equal("value", word_buffer)) {
+      eat_word(line_buffer, value, &i);
+      break;
+    }
+    if (name[0] != '\0') {
+      strncat(name, " ", sizeof(name) - strlen(name) - 1);
+    }
+    strncat(name, word_buffer, sizeof(name) - strlen(name) - 1);
+  }
+  if (strings_equal("Threads", name)) {
+    const i32 threads = atoi(value);
+    if (threads >= 1 && threads <= MAX_SEARCH_THREADS) {
+      search_set_threads(threads);
+    }
+  } else if (strings_equal("Hash", name)) {
+    const u64 hash_mib = strtoull(value, NULL, 10);
+    if (hash_mib >= 1 && hash_mib <= MAX_HASH_MIB) {
+      search_set_hash(hash_mib);
+    }
+  } else if (strings_equal("Clear Hash", name)) {
+    clear_tables();
+  } else if (strings_equal("TT Prefetch", name)) {
+    search_set_tt_prefetch(strings_equal("true", value));
+  } else if (!search_set_parameter(name, atoi(value))) {
+    printf("info string unknown option or value out of range: %s\n", name);
+  }
 }
 
 void command_ucinewgame(char *line_buffer) {
   (void)line_buffer;
-  // not sure if this is meaningful for us
-  // maybe the idea is that we clear hash tables and any other saved state from
-  // the previous game
-  // safe to ignore for now
+  if (refuse_while_searching("ucinewgame")) {
+    return;
+  }
+  clear_tables();
 }
 
 void command_isready(char *line_buffer) {
@@ -284,6 +452,17 @@ void command_uci(char *line_buffer) {
   printf("id name %s %s\n", ENGINE_NAME, ENGINE_VERSION);
   printf("id author Jerome Wei\n");
   printf("option name Foo type check default false\n");
+  printf("option name Threads type spin default 1 min 1 max %i\n",
+         MAX_SEARCH_THREADS);
+  printf("option name Hash type spin default 16 min 1 max %i\n",
+         MAX_HASH_MIB);
+  printf("option name Clear Hash type button\n");
+  printf("option name TT Prefetch type check default true\n");
+  for (i32 i = 0; i < search_parameter_count(); i++) {
+    const SearchParameter *param = search_parameter(i);
+    printf("option name %s type spin default %i min %i max %i\n", param->name,
+           param->default_value, param->min, param->max);
+  }
   printf("uciok\n");
 }
 
@@ -300,13 +479,22 @@ void command_help(char *line_buffer) {
   printf("License and source code available TODO.\n");
 }
 
+/**
+ * test perft|performance|puzzles|hashing|see
+ * The puzzles test searches with the shared tables, so like bench this is
+ * ignored while a search is running.
+ */
 void command_test(char *line_buffer) {
+  if (refuse_while_searching("test")) {
+    return;
+  }
   int i = 0;
   char word_buffer[64];
   while (eat_word(line_buffer, word_buffer, &i)) {
     if (strings_equal("perft", word_buffer)) {
       printf("Testing from file...\n");
-      perft_test_from_file("./test/standard.epd", 8);
+      perft_test_from_file("./test/standard.epd", 8, 64,
+                           hardware_thread_count());
     } else if (strings_equal("performance", word_buffer) ||
                strings_equal("perf", word_buffer)) {
       perft_performance_test();
@@ -315,6 +503,8 @@ void command_test(char *line_buffer) {
     } else if (strings_equal("hashing", word_buffer) ||
                strings_equal("hash", word_buffer)) {
       hashing_test();
+    } else if (strings_equal("see", word_buffer)) {
+      see_test();
     } else if (strings_equal("all", word_buffer)) {
       // TODO: test all;
     }
@@ -324,10 +514,12 @@ void command_test(char *line_buffer) {
 EngineContext *engine_get_context(void) { return ctx; }
 
 void engine_initialize(void) {
+  init_slider_attacks();
   ctx = malloc(sizeof(EngineContext));
   ctx->board = calloc(1, sizeof(Board));
   board_initialize_startpos(ctx->board);
   ctx->stop_thinking = true;
+  ctx->searching = false;
   ctx->debug = false;
   ctx->quit = false;
   ctx->log_fp = fopen("log.txt", "a");
@@ -337,6 +529,11 @@ void engine_initialize(void) {
 }
 
 void engine_cleanup(void) {
+  // The think thread is detached: wait for it to let go of the board and
+  // tables before freeing them.
+  ctx->stop_thinking = true;
+  while (ctx->searching) {
+  }
   free(ctx->board);
   fclose(ctx->log_fp);
   free(ctx);
@@ -11,21 +11,29 @@
 #define THREAD_JOIN pthread_join
 #define THREAD_DETACH pthread_detach
 typedef _Atomic(bool) AtomicBool;
+typedef _Atomic(i32) AtomicInt;
+#define ATOMIC_FETCH_ADD(ptr, value) atomic_fetch_add(ptr, value)
 #elif defined(_WIN32) || defined(WIN32)
 #include <windows.h>
 typedef bool AtomicBool; // TODO: get atomics on Windows
+typedef volatile LONG AtomicInt;
+#define ATOMIC_FETCH_ADD(ptr, value) InterlockedExchangeAdd(ptr, value)
 #define THREAD HANDLE
 void THREAD_CREATE(THREAD* t, void* attr, LPTHREAD_START_ROUTINE f, void*arg);
+void THREAD_JOIN(THREAD t, void **unused);
 void THREAD_DETACH(THREAD t);
 #endif
 
+i32 hardware_thread_count(void);
+
 typedef struct EngineContext {
   FILE *log_fp;
   bool debug;
   bool quit;
   Move best_move;
   f64 think_time_ms;
-  AtomicBool stop_thinking;
+  AtomicBool stop_thinking; // a stop was requested, or no search is running
+  AtomicBool searching;     // the think thread is running: from go to bestmove
   Board *board;
 } EngineContext;
 